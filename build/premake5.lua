@@ -224,6 +224,18 @@ end
         includedirs { "../src" }
         includedirs { "../include" }
 
+        -- Pack cursors, font sheets and the default font into resources/atlas and
+        -- regenerate include/generated/AtlasLayout.hpp before compiling the game, bake the
+        -- font JSON into include/generated/FontMetrics.hpp, then pack everything under
+        -- resources/ (atlas included) into resources/assets.pak
+        dependson { "AtlasPacker", "FontConverter", "AssetArchiver" }
+        prebuildmessage "Packing texture atlas, font metrics and asset archive"
+        prebuildcommands {
+            '"%{cfg.targetdir}/AtlasPacker" "%{wks.location}/resources" "%{wks.location}/include/generated/AtlasLayout.hpp"',
+            '"%{cfg.targetdir}/FontConverter" "%{wks.location}/resources" "%{wks.location}/include/generated/FontMetrics.hpp"',
+            '"%{cfg.targetdir}/AssetArchiver" "%{wks.location}/resources" "%{wks.location}/resources/assets.pak"'
+        }
+
         links { "raylib", "discord_game_sdk" }
 
         cdialect "C17"
@@ -291,6 +303,95 @@ end
 
         filter{}
 
+    project "AtlasPacker"
+        kind "ConsoleApp"
+        location "build_files/"
+        targetdir "../bin/%{cfg.buildcfg}"
+
+        files { "../tools/AtlasPacker.cpp" }
+
+        links { "raylib" }
+        dependson { "raylib" }
+
+        cppdialect "C++17"
+
+        includedirs {raylib_dir .. "/src" }
+        platform_defines()
+
+        filter "action:vs*"
+            defines{"_WINSOCK_DEPRECATED_NO_WARNINGS", "_CRT_SECURE_NO_WARNINGS"}
+            links {"raylib.lib"}
+            characterset ("Unicode")
+            buildoptions { "/Zc:__cplusplus" }
+
+        filter "system:windows"
+            defines{"_WIN32"}
+            links {"winmm", "gdi32", "opengl32"}
+            libdirs {"../bin/%{cfg.buildcfg}"}
+
+        filter "system:linux"
+            links {"pthread", "m", "dl", "rt", "X11"}
+
+        filter "system:macosx"
+            links {"OpenGL.framework", "Cocoa.framework", "IOKit.framework", "CoreFoundation.framework", "CoreAudio.framework", "CoreVideo.framework", "AudioToolbox.framework"}
+
+        filter{}
+
+    project "FontConverter"
+        kind "ConsoleApp"
+        location "build_files/"
+        targetdir "../bin/%{cfg.buildcfg}"
+
+        -- json.hpp and JsonHelper.hpp live next to it; the game itself no longer parses JSON
+        files { "../tools/FontConverter.cpp" }
+
+        cppdialect "C++17"
+
+        filter "action:vs*"
+            defines{"_CRT_SECURE_NO_WARNINGS"}
+            characterset ("Unicode")
+            buildoptions { "/Zc:__cplusplus" }
+
+        filter{}
+
+    project "AssetArchiver"
+        kind "ConsoleApp"
+        location "build_files/"
+        targetdir "../bin/%{cfg.buildcfg}"
+
+        files { "../tools/AssetArchiver.cpp" }
+
+        -- Only the archive format from AssetArchive.hpp, no raylib
+        includedirs { "../include" }
+
+        cppdialect "C++17"
+
+        filter "action:vs*"
+            defines{"_CRT_SECURE_NO_WARNINGS"}
+            characterset ("Unicode")
+            buildoptions { "/Zc:__cplusplus" }
+
+        filter{}
+
+    project "CollisionBench"
+        kind "ConsoleApp"
+        location "build_files/"
+        targetdir "../bin/%{cfg.buildcfg}"
+
+        files { "../tools/CollisionBench.cpp" }
+
+        -- Only constexpr code from the gameplay headers, so raylib's headers but not the library
+        includedirs { "../include", raylib_dir .. "/src" }
+
+        cppdialect "C++17"
+
+        filter "action:vs*"
+            defines{"_CRT_SECURE_NO_WARNINGS"}
+            characterset ("Unicode")
+            buildoptions { "/Zc:__cplusplus" }
+
+        filter{}
+
 -- Add this after the raylib project section
 
 project "discord_game_sdk"
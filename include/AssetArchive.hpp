@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// On-disk layout of resources/assets.pak, written by tools/AssetArchiver at build time:
+//
+//   Header
+//   Entry[count]        sorted by path, so lookups are a binary search
+//   file contents       each starting on an ALIGNMENT boundary
+//
+// Integers are little endian, which every platform we ship on is.
+namespace ArchiveFormat {
+    constexpr char MAGIC[4] = { 'J', 'P', 'K', 'A' };
+    constexpr uint32_t VERSION = 1;
+    constexpr uint64_t ALIGNMENT = 16;
+    constexpr size_t MAX_PATH_LENGTH = 112; // Including the terminating zero
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t count;
+        uint32_t reserved;
+    };
+
+    struct Entry {
+        uint64_t offset; // From the start of the archive
+        uint64_t size;
+        char path[MAX_PATH_LENGTH]; // Relative to resources/, '/' separated
+    };
+
+    static_assert(sizeof(Header) == 16, "Header layout is part of the file format");
+    static_assert(sizeof(Entry) == 128, "Entry layout is part of the file format");
+}
+
+// Read-only view of the archive, memory mapped as a whole. Find returns pointers straight
+// into the mapping, so raylib's *FromMemory loaders read the files without a copy or a
+// syscall per asset. Everything found stays valid until Close (music streams keep
+// reading from it while they play).
+class AssetArchive {
+public:
+    static constexpr const char* DEFAULT_PATH = "assets.pak";
+
+    AssetArchive() = default;
+    ~AssetArchive();
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    // False if the file is missing or isn't a valid archive
+    bool Open(const char* path);
+    void Close();
+    bool IsOpen() const { return m_data != nullptr; }
+
+    // Contents of the file at path (relative to resources/), nullptr if not archived
+    const unsigned char* Find(const char* path, size_t& size) const;
+
+private:
+    const unsigned char* m_data = nullptr;
+    size_t m_size = 0;
+    const ArchiveFormat::Entry* m_entries = nullptr;
+    uint32_t m_count = 0;
+};
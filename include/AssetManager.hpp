@@ -1,13 +1,70 @@
 #pragma once
 #include "raylib.h"
+#include "AssetArchive.hpp"
+#include <memory>
 #include <unordered_map>
 #include <string>
 
+// Handles for everything LoadAssets brings in. Hot paths index arrays with these
+// instead of hashing a name on every draw call or sound
+enum class TextureId {
+    Cursors, // The packed atlas; cursors_1.png sits at its origin, fonts and a white texel after it
+    Count
+};
+
+enum class SoundId {
+    PickupCoin,
+    CowboyGunshot,
+    CowboyDead,
+    CowboyPowerup,
+    CowboyExplosion,
+    CowboyFootstep,
+    CowboyMonsterHit,
+    CowboyGopher,
+    CowboySinging,
+    CowboySecret,
+    OutlawDead,
+    CowboyGunload,
+    CowboyMonsterDie, // No file shipped yet, plays nothing
+    CowboyBoss,       // No file shipped yet, plays nothing
+    Count
+};
+
+enum class FontId {
+    Title,
+    Text,
+    Small, // raylib's default font, packed into the atlas
+    Count
+};
+
+// How far loading has got on the main thread
+enum class LoadStage {
+    None,
+    Graphics, // Atlas and fonts, everything the intro draws
+    Complete  // Sounds and music too
+};
+
 class AssetManager {
 public:
+    AssetManager();
+    ~AssetManager();
+
+    // Files come from AssetArchive::DEFAULT_PATH when it exists, loose files otherwise.
+    // Loads everything before returning
     void LoadAssets();
+    // Decodes files on a worker thread. PollLoading, called every
+    // frame on the main thread, uploads each stage (textures, audio buffers) as it is ready
+    void StartLoading();
+    void PollLoading();
+    bool AreGraphicsLoaded() const { return m_stage >= LoadStage::Graphics; }
+    bool IsLoaded() const { return m_stage == LoadStage::Complete; }
     void UnloadAssets();
     
+    const Texture2D& GetTexture(TextureId id) const { return m_textures[static_cast<int>(id)]; }
+    const Sound& GetSound(SoundId id) const { return m_sounds[static_cast<int>(id)]; }
+    const Font& GetFont(FontId id) const { return m_fonts[static_cast<int>(id)]; }
+
+    // Name based lookups, for tools and one-off code; prefer the handles above
     Texture2D GetTexture(const std::string& name) const;
     Rectangle GetTextureRegion(const std::string& name, int x, int y, int width, int height) const;
     Sound GetSound(const std::string& name) const;
@@ -19,9 +76,16 @@ public:
     void UnloadMusic(const std::string& name);
 
 private:
-    std::unordered_map<std::string, Texture2D> m_textures;
-    std::unordered_map<std::string, Sound> m_sounds;
-    std::unordered_map<std::string, Font> m_fonts;
+    Texture2D m_textures[static_cast<int>(TextureId::Count)] = {};
+    Sound m_sounds[static_cast<int>(SoundId::Count)] = {};
+    Font m_fonts[static_cast<int>(FontId::Count)] = {};
     std::unordered_map<std::string, Music> m_music;
     void LoadFonts();
+
+    // CPU side results of the worker, alive until the last stage is uploaded
+    struct PendingAssets;
+    static void DecodeAssets(PendingAssets& pending);
+    std::unique_ptr<PendingAssets> m_pending;
+    AssetArchive m_archive; // Music streams from it, so it stays mapped until UnloadAssets
+    LoadStage m_stage = LoadStage::None;
 };
@@ -0,0 +1,63 @@
+#pragma once
+#include <chrono>
+#include <vector>
+
+enum class FrameTarget {
+    FPS_60,
+    FPS_120,
+    FPS_144,
+    UNCAPPED,
+    VSYNC,
+    COUNT
+};
+
+// Frame limiter used instead of SetTargetFPS. Wait() sleeps through the OS until about a
+// millisecond before the next deadline and spins the rest of the way, so buffers are
+// swapped on a steady beat instead of whenever the coarse sleep wakes up. The spin
+// margin grows if the OS oversleeps. Deadlines advance by a fixed period, so wake-up
+// error doesn't accumulate; a frame that overruns its period restarts the beat from now
+// instead of rushing the next ones out. Every present is timestamped so pacing can be
+// checked, not just assumed.
+class FramePacer {
+public:
+    // Present-to-present intervals over the recent history
+    struct Stats {
+        int frames = 0;
+        double targetMs = 0.0; // 0 when uncapped
+        double meanMs = 0.0;
+        double stdDevMs = 0.0;
+        double minMs = 0.0;
+        double maxMs = 0.0;
+        double p99Ms = 0.0;
+        int late = 0;          // Intervals over 1.5 target periods
+    };
+
+    // Also switches VSync on or off to match and keeps raylib's own limiter disabled.
+    // Call after InitWindow
+    static void SetTarget(FrameTarget target);
+    static FrameTarget GetTarget() { return s_target; }
+    static const char* GetTargetName(FrameTarget target);
+
+    // Call once the frame is drawn and submitted, right before EndDrawing swaps buffers,
+    // so however long drawing took, the present itself lands on the beat
+    static void Wait();
+    // Call right after EndDrawing
+    static void MarkPresented();
+
+    static Stats GetStats();
+    static void PrintStats();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // One minute at 60 fps
+    static constexpr size_t HISTORY = 3600;
+
+    static FrameTarget s_target;
+    static Clock::duration s_period;     // Zero when Wait() doesn't wait
+    static Clock::duration s_spinMargin;
+    static Clock::time_point s_deadline;
+    static Clock::time_point s_lastPresent;
+    static std::vector<float> s_intervals; // Milliseconds, ring buffer of HISTORY
+    static size_t s_nextInterval;
+};
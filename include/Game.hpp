@@ -12,15 +12,16 @@ enum class GameState {
 
 class Game {
 public:
-    Game(AssetManager& assets, const Vector2& pixelScale);
+    explicit Game(AssetManager& assets);
     ~Game();
 
-    void Update(float deltaTime);
+    // Returns false once the player asked to quit. Nothing should be drawn after that;
+    // the caller shuts down and closes the window
+    bool Update(float deltaTime);
     void Draw();
 
 private:
     AssetManager& m_assets;
-    Vector2 m_pixelScale;
     GameState m_state;
     std::unique_ptr<Screen> m_currentScreen;
 };
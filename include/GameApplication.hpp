@@ -14,6 +14,5 @@ public:
 private:
     AssetManager m_assets;
     std::unique_ptr<Game> m_game;
-    Vector2 m_pixelScale;
     bool m_isRunning;
 };
@@ -0,0 +1,70 @@
+#pragma once
+#include <string>
+#include <vector>
+
+class AssetManager;
+
+// Options for a headless run, filled from the command line
+struct HeadlessOptions {
+    std::string replayPath;         // Empty plays with no input
+    std::vector<int> captureTicks;  // Ticks saved as PNG (and compared when goldenDir is set)
+    int frames = 0;                 // Ticks to simulate; 0 runs to the last capture or replay event
+    std::string outputDir = "headless_out";
+    std::string goldenDir;
+    int tolerance = 0;              // Per channel difference still counted as equal
+    int maxDiffPixels = 0;          // Differing pixels allowed before a capture fails
+    int width = 1280;
+    int height = 720;
+    std::string statsPath;          // Per frame CSV: tick, update ms, draw ms, draw calls
+    int horde = 0;                  // Extra orcs dropped on the map before the first tick
+    std::string check;              // Self-check run instead of a replay, see HeadlessRunner
+    std::string error;
+};
+
+// Runs the gameplay screen from a replay in a hidden window at a fixed 60 ticks per
+// second, renders every tick, saves the requested ticks as PNG and compares them with
+// golden images. Prints per frame draw time and draw call totals at the end.
+//
+//     JotPK --headless --replay run.txt --ticks 60,600,1800 --golden goldens/ --out shots/
+//
+// --horde N is the crowd stress test: N orcs on random tiles from the first tick, packed
+// on top of each other, so every monster query sees a full neighborhood. God mode is on
+// for the run, so the crowd isn't cleared when it reaches the player. The update ms
+// in the summary has to stay under 16.7 for the game to hold 60 Hz:
+//
+//     JotPK --headless --horde 2000 --frames 600
+//
+// --check sweep fires a fixed set of bullets at standing monsters and a fence in steps of
+// 1/60, 1/10 and 1/4 s, and fails unless every run leaves exactly the same monsters hit:
+//
+//     JotPK --headless --check sweep
+//
+// Exit code is 0 when every capture matches, 1 on a mismatch, 2 on bad arguments or
+// missing files. On CPU-only Linux run it under xvfb-run with LIBGL_ALWAYS_SOFTWARE=1
+// so Mesa's llvmpipe does the rendering. tools/replay_check.sh does all that for every
+// replay under tools/replays, and CI runs it on each push.
+class HeadlessRunner {
+public:
+    // True when --headless was given; options.error is set if the rest didn't parse
+    static bool ParseArgs(int argc, char** argv, HeadlessOptions& options);
+
+    explicit HeadlessRunner(const HeadlessOptions& options) : m_options(options) {}
+
+    int Run();
+
+private:
+    struct FrameStats {
+        int tick;
+        double updateMs;
+        double drawMs;
+        int drawCalls;
+    };
+
+    static bool CheckBulletSweep(AssetManager& assets);
+    bool CheckCapture(int tick, const std::string& shotPath) const;
+    void PrintSummary() const;
+    bool WriteStats() const;
+
+    HeadlessOptions m_options;
+    std::vector<FrameStats> m_frames;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+// Counts the GL draw calls raylib and our own renderers issue, for benchmarks and the
+// headless runner. Install() wraps the glDraw* function pointers raylib loaded through
+// glad, so everything is counted, including rlgl batch flushes. Only available on the
+// desktop GL 2.1/3.3/4.3 backends; elsewhere GetDrawCalls() stays at -1.
+class RenderStats {
+public:
+    // Call after InitWindow, once the GL functions are loaded
+    static void Install();
+
+    static bool IsInstalled() { return s_installed; }
+
+    // Starts counting a new frame
+    static void BeginFrame() { s_drawCalls = s_installed ? 0 : -1; }
+    static int GetDrawCalls() { return s_drawCalls; }
+
+    // Called from the wrappers
+    static void CountDrawCall() { s_drawCalls++; }
+
+private:
+    static bool s_installed;
+    static int s_drawCalls;
+};
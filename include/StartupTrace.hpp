@@ -0,0 +1,24 @@
+#pragma once
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Timestamps of startup milestones relative to Begin(), printed once with Print().
+// Mark() may be called from the asset loading thread as well as the main one.
+class StartupTrace {
+public:
+    static void Begin();
+    static void Mark(const char* label);
+    static void Print();
+
+private:
+    struct Entry {
+        std::string label;
+        double ms;
+    };
+
+    static std::chrono::steady_clock::time_point s_start;
+    static std::vector<Entry> s_entries;
+    static std::mutex s_mutex;
+};
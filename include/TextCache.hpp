@@ -0,0 +1,54 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// One string laid out into glyph quads for a given font and size. The layout is only
+// rebuilt when the text or style changes, and drawing it is a single textured run
+// instead of DrawTextEx's per-glyph lookups and measuring.
+class TextRun {
+public:
+    struct Glyph {
+        Rectangle source;
+        Rectangle dest; // Relative to the run's top-left
+    };
+
+    // Lays the text out again only if it differs from what the run already holds
+    void Set(const Font& font, const char* text, float fontSize, float spacing);
+    // prefix + value, for counters; the common case of an unchanged value is an int compare
+    void SetNumber(const Font& font, const char* prefix, int value, float fontSize, float spacing);
+
+    Vector2 GetSize() const { return m_size; }
+    const std::vector<Glyph>& GetGlyphs() const { return m_glyphs; }
+    void Draw(Vector2 position, Color tint) const;
+
+private:
+    bool Matches(const Font& font, float fontSize, float spacing) const;
+    void Layout(const Font& font, const char* text, float fontSize, float spacing);
+
+    std::string m_text;
+    // Fonts share the atlas texture, so their glyph rects are what tells them apart
+    const Rectangle* m_recs = nullptr;
+    Texture2D m_texture = {};
+    float m_fontSize = 0.0f;
+    float m_spacing = 0.0f;
+    Vector2 m_size = {0.0f, 0.0f};
+    std::vector<Glyph> m_glyphs;
+
+    bool m_hasNumber = false;
+    int m_number = 0;
+    size_t m_prefixLength = 0;
+};
+
+// Runs for strings that rarely or never change (labels, menu entries), laid out on
+// first use. Lookups hash the text in place, so a hit allocates nothing
+class TextCache {
+public:
+    const TextRun& Get(const Font& font, const char* text, float fontSize, float spacing);
+    void Clear() { m_runs.clear(); }
+
+private:
+    std::unordered_map<uint64_t, TextRun> m_runs;
+};
@@ -0,0 +1,40 @@
+#pragma once
+#include "raylib.h"
+
+// Fixed low resolution canvas for the arena. The world is drawn at native pixel size
+// (16px tiles) into a 256x256 render texture and then shown with one point filtered
+// quad at the largest whole multiple of that size that fits the window, so every
+// screen scales the same way and fill rate no longer grows with the display.
+class VirtualScreen {
+public:
+    static constexpr int WIDTH = 256;
+    static constexpr int HEIGHT = 256;
+    // Native pixels kept free around the arena for the HUD (timer bar, lives, boss health)
+    static constexpr int BORDER = 16;
+
+    VirtualScreen() = default;
+    ~VirtualScreen();
+    VirtualScreen(const VirtualScreen&) = delete;
+    VirtualScreen& operator=(const VirtualScreen&) = delete;
+
+    // Whole number of screen pixels per virtual pixel for the current window (at least 1)
+    static int GetScale();
+    // Where the canvas lands on screen: GetScale() times its size, centered
+    static Rectangle GetViewport();
+    // Same for a window of the given size, for code that must not query the window
+    static int GetScale(int screenWidth, int screenHeight);
+    static Rectangle GetViewport(int screenWidth, int screenHeight);
+
+    // Redirects drawing into the canvas through camera, which maps whatever units the
+    // caller draws in onto virtual pixels. Not nestable with other texture modes
+    void Begin(const Camera2D& camera);
+    void End();
+    // Upscales the canvas into GetViewport()
+    void Draw() const;
+
+private:
+    void Load();
+
+    RenderTexture2D m_target = {};
+    bool m_loaded = false;
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include <memory>
+#include <mutex>
 
 namespace discord {
     class Core;
@@ -15,4 +16,6 @@ public:
 private:
     static std::unique_ptr<discord::Core> s_core;
     static std::int64_t s_startTime;
+    // UpdatePresence is called from the simulation thread, RunCallbacks from the main one
+    static std::mutex s_mutex;
 };
\ No newline at end of file
@@ -0,0 +1,143 @@
+#pragma once
+#include "TextCache.hpp"
+#include "raylib.h"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Everything the gameplay screen puts on screen for one tick, recorded without touching
+// GL. The simulation fills a list on its own thread and DrawListRenderer replays it on
+// the thread that owns the window, so the two only meet when the lists are swapped.
+// Commands are replayed in the order they were recorded. World sprites wait in a depth
+// sorted queue until FlushSprites, exactly like SpriteBatch. Everything else is drawn
+// where it was recorded.
+//
+// Every source rect refers to the atlas (TextureId::Cursors); fonts and the white texel
+// used for rectangles live there too.
+class DrawList
+{
+public:
+    // Where the commands that follow a BeginPass are drawn
+    enum class Pass : uint8_t
+    {
+        World,  // Into the virtual screen through the pass camera
+        Hud,    // Onto the window through the pass camera
+        Screen  // Onto the window in pixels
+    };
+
+    // Pre-rendered map layers. Their tiles travel with the list and the renderer only
+    // re-renders a layer when its revision changes
+    enum TileLayer
+    {
+        MAP_LAYER,
+        NEXT_MAP_LAYER,
+        TILE_LAYER_COUNT
+    };
+    static constexpr int MAP_SIZE = 16;
+
+    struct TileLayerState
+    {
+        int tiles[MAP_SIZE][MAP_SIZE] = {};
+        int world = -1;
+        unsigned int revision = 0;
+    };
+
+    struct Sprite
+    {
+        Rectangle source;
+        Rectangle dest;
+        Color tint;
+        float rotation;
+        float depth;
+        bool flipX;
+    };
+
+    struct Quad
+    {
+        Rectangle source;
+        Rectangle dest;
+        Color tint;
+    };
+
+    struct Instance
+    {
+        Vector2 position;
+        int frame;
+    };
+
+    enum class CommandType : uint8_t
+    {
+        BeginPass,
+        Clear,
+        TileLayer,
+        Sprites,      // Queues sprites [first, first + count)
+        ClearSprites, // Drops the queued sprites
+        FlushSprites, // Draws queued sprites with depth below value (all of them when infinite)
+        Quads,        // Draws quads [first, first + count) in order
+        Instances     // Draws instances [first, first + count) of source at size
+    };
+
+    struct Command
+    {
+        CommandType type;
+        Pass pass;
+        int layer;
+        int frame;
+        Camera2D camera;
+        Color color;
+        Rectangle source;
+        Vector2 position; // Tile layer position, instance size
+        float value;      // Tile layer scale, flush depth
+        uint32_t first;
+        uint32_t count;
+    };
+
+    // Empties the list for a new tick. Tile layer snapshots are kept, so an unchanged
+    // map isn't copied again
+    void Reset();
+
+    void BeginPass(Pass pass, const Camera2D &camera = Camera2D{});
+    void Clear(Color color);
+
+    // Copies the tiles only when world or revision differ from what the list holds
+    void SetTileLayer(TileLayer layer, const int (&tiles)[MAP_SIZE][MAP_SIZE], int world, unsigned int revision);
+    void AddTileLayer(TileLayer layer, Vector2 position, float scale, int frame);
+
+    // Same arguments as SpriteBatch::Add
+    void AddSprite(const Rectangle &source, const Rectangle &dest, float depth,
+                   Color tint = WHITE, float rotation = 0.0f, bool flipX = false);
+    void ClearSprites();
+    void FlushSprites(float maxDepth = INFINITY);
+
+    void AddQuad(const Rectangle &source, const Rectangle &dest, Color tint = WHITE);
+    void AddRectangle(float x, float y, float width, float height, Color color);
+    void AddRectangle(const Rectangle &rect, Color color);
+    void AddRectangleLines(const Rectangle &rect, float thickness, Color color);
+
+    // Copies the run's glyph quads, so the run may change or go away afterwards
+    void AddText(const TextRun &run, Vector2 position, Color tint);
+    // Lays text out on the spot, for strings that change every tick (debug overlay)
+    void AddText(const Font &font, const char *text, Vector2 position, float fontSize, float spacing, Color tint);
+
+    // Starts a group of instances sharing one sprite, filled by AddInstance
+    void BeginInstances(const Rectangle &source, Vector2 size, Color tint = WHITE);
+    void AddInstance(Vector2 position, int frame = 0);
+
+    const std::vector<Command> &GetCommands() const { return m_commands; }
+    const std::vector<Sprite> &GetSprites() const { return m_sprites; }
+    const std::vector<Quad> &GetQuads() const { return m_quads; }
+    const std::vector<Instance> &GetInstances() const { return m_instances; }
+    const TileLayerState &GetTileLayer(TileLayer layer) const { return m_tileLayers[layer]; }
+
+private:
+    Command &Push(CommandType type);
+    // The last command when it is a range of this type, so consecutive adds share it
+    Command *OpenRange(CommandType type);
+
+    std::vector<Command> m_commands;
+    std::vector<Sprite> m_sprites;
+    std::vector<Quad> m_quads;
+    std::vector<Instance> m_instances;
+    TileLayerState m_tileLayers[TILE_LAYER_COUNT];
+    TextRun m_scratchText;
+};
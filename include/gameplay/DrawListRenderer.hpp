@@ -0,0 +1,27 @@
+#pragma once
+#include "gameplay/DrawList.hpp"
+#include "gameplay/SpriteBatch.hpp"
+#include "gameplay/SpriteInstancer.hpp"
+#include "gameplay/TileLayerCache.hpp"
+#include "VirtualScreen.hpp"
+
+// Turns a DrawList into raylib/rlgl calls. Owns every GL resource the gameplay screen
+// draws with (virtual screen, cached tile layers, instancing buffers), so it must live
+// on the thread that created the window. Call between BeginDrawing and EndDrawing
+class DrawListRenderer
+{
+public:
+    void Render(const DrawList &list, const Texture2D &atlas);
+
+private:
+    void RefreshTileLayer(const DrawList &list, DrawList::TileLayer layer, const Texture2D &atlas);
+    void EndPass();
+
+    SpriteBatch m_spriteBatch;     // World sprites between two FlushSprites commands
+    SpriteInstancer m_instancer;   // Bullets and top layer particles
+    VirtualScreen m_virtualScreen; // Target of the world pass
+    TileLayerCache m_tileLayers[DrawList::TILE_LAYER_COUNT];
+    unsigned int m_tileRevisions[DrawList::TILE_LAYER_COUNT] = {};
+    bool m_inPass = false;
+    DrawList::Pass m_pass = DrawList::Pass::Screen;
+};
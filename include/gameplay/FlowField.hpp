@@ -0,0 +1,45 @@
+#pragma once
+#include "gameplay/TileMask.hpp"
+#include <cstdint>
+
+// Breadth-first distance field over the arena toward a single goal tile.
+// Every chasing monster samples it to pick its next tile instead of steering greedily.
+class FlowField
+{
+public:
+    static constexpr int SIZE = TileMask::SIZE;
+    static constexpr uint16_t UNREACHABLE = 0xFFFF;
+
+    // Movement directions, same numbering as CowboyMonster::movementDirection
+    static constexpr int NO_DIRECTION = -1;
+    static constexpr int UP = 0;
+    static constexpr int RIGHT = 1;
+    static constexpr int DOWN = 2;
+    static constexpr int LEFT = 3;
+
+    FlowField();
+
+    void Rebuild(const TileMask &blocked, int goalX, int goalY);
+
+    // Patches the field after the tiles in `dirty` were edited, without a full BFS.
+    // Tiles that opened up pull their neighbours' distances down (decrease-key), tiles
+    // that closed invalidate everything that only reached the goal through them, which
+    // is then re-seeded from the untouched boundary (increase-key). Same goal as before.
+    void Repair(const TileMask &blocked, const TileMask &dirty);
+
+    uint16_t GetDistance(int x, int y) const;
+    int GetDirection(int x, int y) const;
+    int GetGoalX() const { return m_goalX; }
+    int GetGoalY() const { return m_goalY; }
+
+    static int StepX(int direction) { return direction == RIGHT ? 1 : (direction == LEFT ? -1 : 0); }
+    static int StepY(int direction) { return direction == DOWN ? 1 : (direction == UP ? -1 : 0); }
+
+private:
+    uint16_t LowestNeighbourDistance(int x, int y) const;
+
+    TileMask m_blocked;
+    uint16_t m_distance[SIZE][SIZE]; // Indexed [x][y] like the map
+    int m_goalX;
+    int m_goalY;
+};
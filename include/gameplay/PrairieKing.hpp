@@ -1,8 +1,15 @@
 #pragma once
 #include "AssetManager.hpp"
+#include "gameplay/TileMask.hpp"
+#include "gameplay/SpatialGrid.hpp"
+#include "gameplay/FlowField.hpp"
+#include "gameplay/BulletBatch.hpp"
+#include "gameplay/DrawList.hpp"
+#include "TextCache.hpp"
 #include "raylib.h"
 #include "raymath.h"
 #include <vector>
+#include <cstdint>
 #include <unordered_map>
 #include <unordered_set>
 #include <memory>
@@ -45,46 +52,6 @@ namespace GameConstants
     constexpr int PLAYER_INVINCIBLE_DURATION = 5000; // 5 seconds invincibility after death
 }
 
-// Equality operators for raylib types
-inline bool operator==(const Rectangle &lhs, const Rectangle &rhs)
-{
-    return lhs.x == rhs.x && lhs.y == rhs.y &&
-           lhs.width == rhs.width && lhs.height == rhs.height;
-}
-
-// Custom hash functions for raylib types
-namespace std
-{
-    template <>
-    struct hash<Vector2>
-    {
-        size_t operator()(const Vector2 &vec) const
-        {
-            // Combine the hash of both Vector2 components
-            size_t seed = 0;
-            seed ^= std::hash<float>()(vec.x) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-            seed ^= std::hash<float>()(vec.y) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-            return seed;
-        }
-    };
-
-    template <>
-    struct hash<Rectangle>
-    {
-        size_t operator()(const Rectangle &rect) const
-        {
-            // Use hash_combine technique for combining hashes
-            size_t seed = 0;
-            // Combine the hash of all Rectangle components using boost's hash_combine technique
-            seed ^= std::hash<float>()(rect.x) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-            seed ^= std::hash<float>()(rect.y) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-            seed ^= std::hash<float>()(rect.width) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-            seed ^= std::hash<float>()(rect.height) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-            return seed;
-        }
-    };
-}
-
 class PrairieKing
 {
 public:
@@ -129,7 +96,6 @@ public:
     };
 
     // Helper functions
-    std::vector<Vector2> GetBorderPoints();
     static float GetRandomFloat(float min, float max);
     static int GetRandomInt(int min, int max);
     Vector2 GetRandomVector2(float minX, float maxX, float minY, float maxY);
@@ -161,6 +127,12 @@ public:
     static constexpr int PLAYER_FOOTSTEP_DELAY = 200;
     static constexpr int DEATH_DELAY = 3000;
 
+    // Sprite batch layer depths (lower is drawn first). Characters sort by their y in between
+    static constexpr float GROUND_DEPTH = 0.001f;
+    static constexpr float BULLET_DEPTH = 0.9f;
+    static constexpr float EFFECT_DEPTH = 1.0f;
+    static constexpr float GetCharacterDepth(float y) { return GROUND_DEPTH + y / 10000.0f; }
+
     // Map tile types
     static constexpr int MAP_BARRIER1 = 0;
     static constexpr int MAP_BARRIER2 = 1;
@@ -173,6 +145,64 @@ public:
     static constexpr int MAP_TRENCH2 = 9;
     static constexpr int MAP_BRIDGE = 10;
 
+    // Collision layers. Tiles and monster bodies list the layers they block and every mover
+    // lives on one layer, so each passability question is a single AND of masks
+    static constexpr uint8_t LAYER_PLAYER = 1 << 0;
+    static constexpr uint8_t LAYER_WALKER = 1 << 1; // Monsters on foot
+    static constexpr uint8_t LAYER_FLYER = 1 << 2;  // Butterflies and imps, only other bodies stop them
+    static constexpr uint8_t LAYER_BULLET = 1 << 3;
+    static constexpr int COLLISION_LAYER_COUNT = 4;
+
+    // Walkers wander over the barrier tiles, so for them the arena edge is the wall
+    static constexpr uint8_t ARENA_BOUNDED_LAYERS = LAYER_WALKER;
+
+    // Layers blocked by each tile type, indexed by MAP_*. Trenches stop feet but not bullets,
+    // barriers stop the player and bullets but not monsters
+    static constexpr uint8_t TILE_COLLISION_LAYERS[] = {
+        LAYER_PLAYER | LAYER_BULLET,                // MAP_BARRIER1
+        LAYER_PLAYER | LAYER_BULLET,                // MAP_BARRIER2
+        0,                                          // MAP_ROCKY1
+        0,                                          // MAP_DESERT
+        0,                                          // MAP_GRASSY
+        LAYER_PLAYER | LAYER_WALKER,                // MAP_CACTUS
+        LAYER_PLAYER,                               // 6
+        LAYER_PLAYER | LAYER_WALKER | LAYER_BULLET, // MAP_FENCE
+        LAYER_PLAYER | LAYER_WALKER,                // MAP_TRENCH1
+        LAYER_PLAYER | LAYER_WALKER,                // MAP_TRENCH2
+        0,                                          // MAP_BRIDGE
+    };
+
+    static constexpr uint8_t GetTileCollisionLayers(int tileType)
+    {
+        return (tileType >= 0 && tileType < static_cast<int>(sizeof(TILE_COLLISION_LAYERS)))
+                   ? TILE_COLLISION_LAYERS[tileType]
+                   : 0;
+    }
+
+    static constexpr int GetLayerIndex(uint8_t layer)
+    {
+        int index = 0;
+        while (index < COLLISION_LAYER_COUNT - 1 && (layer >> index) != 1)
+        {
+            index++;
+        }
+        return index;
+    }
+
+    // Tile sets on the arena grid
+    static constexpr TileMask ARENA_BORDER_TILES = TileMask::Outline(0, 0, MAP_WIDTH, MAP_HEIGHT);
+    static constexpr TileMask SPAWN_TILES = TileMask::FromRect(0, 6, 1, 3) | TileMask::FromRect(15, 6, 1, 3) |
+                                            TileMask::FromRect(6, 0, 3, 1) | TileMask::FromRect(6, 15, 3, 1);
+
+    // Shop slots
+    static constexpr int MAX_STORE_ITEMS = 16;
+
+    struct StoreItem
+    {
+        Rectangle bounds;
+        int item;
+    };
+
     // Monster types
     static constexpr int ORC = 0;
     static constexpr int EVIL_BUTTERFLY = 1;
@@ -183,6 +213,33 @@ public:
     static constexpr int SPIKEY = 6;
     static constexpr int DRACULA = 7;
 
+    // Layer each monster type moves on and the layers its body blocks, indexed by type.
+    // Spikeys don't get in anyone's way until they turn into a block
+    struct MonsterCollision
+    {
+        uint8_t layer;
+        uint8_t blocks;
+    };
+    static constexpr uint8_t SOLID_BODY_LAYERS = LAYER_WALKER | LAYER_FLYER;
+    static constexpr MonsterCollision MONSTER_COLLISION[] = {
+        {LAYER_WALKER, SOLID_BODY_LAYERS}, // ORC
+        {LAYER_FLYER, SOLID_BODY_LAYERS},  // EVIL_BUTTERFLY
+        {LAYER_WALKER, SOLID_BODY_LAYERS}, // OGRE
+        {LAYER_WALKER, SOLID_BODY_LAYERS}, // MUMMY
+        {LAYER_FLYER, SOLID_BODY_LAYERS},  // IMP
+        {LAYER_WALKER, SOLID_BODY_LAYERS}, // MUSHROOM
+        {LAYER_WALKER, 0},                 // SPIKEY
+        {LAYER_WALKER, SOLID_BODY_LAYERS}, // DRACULA
+    };
+
+    // Bosses outside the table (the outlaw uses -1) walk and block like everyone else
+    static constexpr MonsterCollision GetMonsterCollision(int type)
+    {
+        return (type >= 0 && type < static_cast<int>(sizeof(MONSTER_COLLISION) / sizeof(MONSTER_COLLISION[0])))
+                   ? MONSTER_COLLISION[type]
+                   : MonsterCollision{LAYER_WALKER, SOLID_BODY_LAYERS};
+    }
+
     // World types
     static constexpr int DESERT_WORLD = 0;
     static constexpr int GRAVEYARD = 1;
@@ -232,7 +289,7 @@ public:
     {
     public:
         CowboyPowerup(int which, Vector2 position, int duration);
-        void Draw(const Texture2D &cursorTexture, Vector2 topLeftScreenCoordinate) const; // Add const here
+        void Draw(DrawList &list, Vector2 topLeftScreenCoordinate) const;
 
         int which;
         Vector2 position;
@@ -296,7 +353,7 @@ public:
                                 int startFrame, Vector2 pos, float rot, float scale,
                                 bool flip, float depth, Color color);
         bool Update(float deltaTime);
-        void Draw(const Texture2D &texture);
+        void Draw(DrawList &list) const;
     };
 
     class CowboyMonster
@@ -323,12 +380,20 @@ public:
         int ticksSinceLastMovement;
         Vector2 acceleration;
         Vector2 targetPosition;
+        int gridCell = -1;           // Bucket in PrairieKing::m_monsterGrid
+        unsigned int spawnOrder = 0; // Matches the order in PrairieKing::m_monsters
+        bool removed = false;        // Taken out during the Move loop, freed after it
 
         CowboyMonster(AssetManager &assets, int which, int health, int speed, Vector2 position);
         CowboyMonster(AssetManager &assets, int which, Vector2 position);
         virtual ~CowboyMonster() = default;
 
-        virtual void Draw(const Texture2D &texture, Vector2 topLeftScreenCoordinate);
+        uint8_t GetCollisionLayer() const { return GetMonsterCollision(type).layer; }
+        uint8_t GetBodyLayers() const { return spikeyIsBlock ? SOLID_BODY_LAYERS : GetMonsterCollision(type).blocks; }
+
+        // Atlas sprites go to the depth sorted queue; DrawOverlay runs after it is flushed (text, health bars)
+        virtual void Draw(DrawList &list, Vector2 topLeftScreenCoordinate);
+        virtual void DrawOverlay(DrawList &list, Vector2 topLeftScreenCoordinate);
         virtual bool TakeDamage(int damage);
         virtual int GetLootDrop();
         virtual bool Move(Vector2 playerPosition, float deltaTime);
@@ -340,6 +405,7 @@ public:
         }
         // Funciones auxiliares para el movimiento
         Vector2 GetVelocityTowardPoint(Vector2 start, Vector2 end, float speed);
+        static Vector2 GetPlayerAimPoint();
         int GetRandomInt(int min, int max);
         float GetRandomFloat(float min, float max);
     };
@@ -361,7 +427,8 @@ public:
         Vector2 homePosition;
 
         Dracula(AssetManager &assets);
-        void Draw(const Texture2D &texture, Vector2 topLeftScreenCoordinate) override;
+        void Draw(DrawList &list, Vector2 topLeftScreenCoordinate) override;
+        void DrawOverlay(DrawList &list, Vector2 topLeftScreenCoordinate) override;
         int GetLootDrop() override;
         bool TakeDamage(int damage) override;
         bool Move(Vector2 playerPosition, float deltaTime) override;
@@ -389,7 +456,8 @@ public:
         Vector2 homePosition;
 
         Outlaw(AssetManager &assets, Vector2 position, int health);
-        void Draw(const Texture2D &texture, Vector2 topLeftScreenCoordinate) override;
+        void Draw(DrawList &list, Vector2 topLeftScreenCoordinate) override;
+        void DrawOverlay(DrawList &list, Vector2 topLeftScreenCoordinate) override;
         bool Move(Vector2 playerPosition, float deltaTime) override;
         int GetLootDrop() override;
         bool TakeDamage(int damage) override;
@@ -398,11 +466,32 @@ public:
     PrairieKing(AssetManager &assets);
     ~PrairieKing() = default;
 
+    // Everything the simulation reads from the window for one tick. It is gathered on
+    // the main thread, so Update and Draw never call into raylib's input or window state
+    struct InputFrame
+    {
+        struct KeyEvent
+        {
+            GameKeys key;
+            bool pressed;
+        };
+        std::vector<KeyEvent> keys; // Fed to SetButtonState in order
+        Vector2 pointer = {0.0f, 0.0f};
+        bool pointerPressed = false; // Left button went down this frame
+        int screenWidth = 0;
+        int screenHeight = 0;
+        int fps = 0;
+    };
+
     void Initialize();
+    void ApplyInput(const InputFrame &input);
     void Update(float deltaTime);
-    void Draw();
+    // Records the frame into list. Touches no GL state, so it can run on the simulation thread
+    void Draw(DrawList &list);
     bool IsGameOver() const { return m_gameOver; }
     bool ShouldReturnToMenu() const { return m_shouldReturnToMenu; }
+    // "Quit Game" was picked; the thread that owns the window closes it
+    bool IsCloseRequested() const { return m_closeRequested; }
     void SetShouldReturnToMenu(bool value) { m_shouldReturnToMenu = value; }
 
     // Game state functions
@@ -421,37 +510,93 @@ public:
     void EndOfGopherAnimationBehavior(int extraInfo);
     static void KillOutlaw();
     void UpdateBullets(float deltaTime);
+    void HitMonsterWithBullet(int k, CowboyBullet &bullet);
     void PlayerDie();
     void AfterPlayerDeathFunction(int extra);
     void StartNewRound();
     void ProcessInputs();
     void SpawnBullets(const std::vector<int> &directions, Vector2 spawn);
     bool IsSpawnQueueEmpty();
-    static bool IsMapTilePassable(int tileType);
-    static bool IsMapTilePassableForBullets(int tileType);
-    static bool IsMapTilePassableForMonsters(int tileType);
-    bool IsCollidingWithMapForBullets(Vector2 position);
+    // Map collision against a blocked-tile mask; tiles off the map count as blocked
+    static constexpr bool IsRectBlocked(const TileMask &blocked, Rectangle r)
+    {
+        int tileX1 = static_cast<int>(r.x) / (BASE_TILE_SIZE * PIXEL_ZOOM);
+        int tileY1 = static_cast<int>(r.y) / (BASE_TILE_SIZE * PIXEL_ZOOM);
+        int tileX2 = static_cast<int>(r.x + r.width - 1) / (BASE_TILE_SIZE * PIXEL_ZOOM);
+        int tileY2 = static_cast<int>(r.y + r.height - 1) / (BASE_TILE_SIZE * PIXEL_ZOOM);
+
+        if (tileX2 < tileX1 || tileY2 < tileY1)
+        {
+            return false;
+        }
+        if (tileX1 < 0 || tileY1 < 0 || tileX2 >= MAP_WIDTH || tileY2 >= MAP_HEIGHT)
+        {
+            return true;
+        }
+        return blocked.AnyInRect(tileX1, tileY1, tileX2, tileY2);
+    }
+
+    static constexpr bool IsPointBlocked(const TileMask &blocked, Vector2 position)
+    {
+        int tileX = static_cast<int>(position.x) / (BASE_TILE_SIZE * PIXEL_ZOOM);
+        int tileY = static_cast<int>(position.y) / (BASE_TILE_SIZE * PIXEL_ZOOM);
+        return !TileMask::InBounds(tileX, tileY) || blocked.Test(tileX, tileY);
+    }
+
+    // Every write to m_map goes through these so the masks and flow field stay in sync
+    void LoadMap(int wave);
+    void SetMap(const int (&newMap)[MAP_WIDTH][MAP_HEIGHT]);
+    void SetMapTile(int x, int y, int tileType);
+    void LoadNextMap(int wave);
+    static Rectangle GetTileSourceRect(int tileType, int world, int frame);
+    void RebuildPassabilityMasks();
+    void UpdateFlowField();
+    Vector2 GetFlowFieldTarget(const Rectangle &position, float speed) const;
     bool IsCollidingWithMonster(Rectangle r, CowboyMonster *subject);
-    bool IsCollidingWithMapForMonsters(Rectangle positionToCheck);
-    bool IsCollidingWithMap(Rectangle positionToCheck);
-    bool IsCollidingWithMap(Vector2 position);
+    bool IsCollidingWithMap(Rectangle positionToCheck, uint8_t layer = LAYER_PLAYER);
+    bool IsCollidingWithMap(Vector2 position, uint8_t layer = LAYER_PLAYER);
+    const TileMask &GetBlockedTiles(uint8_t layer) const { return m_blockedTiles[GetLayerIndex(layer)]; }
     void AddPlayerMovementDirection(int direction);
     void AddPlayerShootingDirection(int direction);
     void StartShoppingLevel();
     int GetPriceForItem(int whichItem) const;
     void GetMap(int wave, int (&newMap)[MAP_WIDTH][MAP_HEIGHT]);
-    std::vector<Vector2> GetBorderPoints(const Rectangle &rect);
+    void RebuildPowerupEjectionField();
+    Vector2 GetPowerupLandingSpot(Vector2 position); // Rebuilds the ejection field first if the map changed
+    int GetPowerupTileX(Vector2 position) const;      // Tile under the middle of a powerup
+    int GetPowerupTileY(Vector2 position) const;
+
+    // Spatial queries shared by all gameplay code. Monsters come from m_monsterGrid,
+    // which Update keeps current every tick; powerups and the gopher are few enough to
+    // test directly. Results go into caller arrays and the count is returned
+    static constexpr int ANY_MONSTER_TYPE = -1;
+    static constexpr int MAX_QUERY_RESULTS = 64;
+
+    int QueryMonstersInRect(const Rectangle &area, CowboyMonster **out, int capacity, int type = ANY_MONSTER_TYPE) const;
+    int QueryPowerupsInRect(const Rectangle &area, int *out, int capacity) const; // Indices, highest first
+    bool FindRunningGopher(Vector2 &outPosition) const;
+    bool RaycastTiles(Vector2 from, Vector2 to, const TileMask &blocked, float &hitT) const;
 
     // Helper functions for rendering and resource access
-    Texture2D GetTexture(const std::string &name);
-    Sound GetSound(const std::string &name);
-    static Sound GetSoundStatic(const std::string &name);
+    const Texture2D &GetTexture(TextureId id) const { return m_assets.GetTexture(id); }
+    const Sound &GetSound(SoundId id) const { return m_assets.GetSound(id); }
+    static const Sound &GetSoundStatic(SoundId id);
     Rectangle GetRectForShopItem(int itemID);
+    void ClearStoreItems();
+    void AddStoreItem(const Rectangle &bounds, int item);
+    void RemoveStoreItem(int slot);
+    int GetStoreItemAt(const Rectangle &box) const;
     JOTPKProgress GetProgress() const;
     void SetButtonState(GameKeys key, bool pressed);
     void UpdatePlayer(float deltaTime);
     void StartNewWave();
     void AddMonster(CowboyMonster *monster);
+    void AddPowerup(const CowboyPowerup &powerup);
+    void PushMonster(CowboyMonster *monster);
+    void PushBullet(const CowboyBullet &bullet);
+    void RemoveMonster(int index);
+    void RemoveMonster(CowboyMonster *monster);
+    void RebuildMonsterGrid();
     void AddTemporarySprite(const TemporaryAnimatedSprite &sprite);
 
     // Static function to get the current game instance
@@ -551,6 +696,7 @@ private:
     bool m_waveCompleted = false;
     bool m_godMode = false;
     bool m_shouldReturnToMenu = false;
+    bool m_closeRequested = false;
 
     // Game objects
     Vector2 m_playerPosition;
@@ -569,41 +715,92 @@ private:
 
     // Collections
     std::vector<CowboyMonster *> m_monsters;
-    std::unordered_set<Vector2> m_borderTiles;
+    SpatialGrid<CowboyMonster> m_monsterGrid;
+    bool m_movingMonsters = false;                     // Inside the per-tick Move loop, see RemoveMonster
+    std::vector<CowboyMonster *> m_removedWhileMoving; // Off the grid already, freed after the loop
+    unsigned int m_nextMonsterSpawnOrder = 0;
     std::vector<int> m_playerMovementDirections;
     std::vector<int> m_playerShootingDirections;
     std::vector<CowboyBullet> m_bullets;
-    std::vector<CowboyBullet> m_enemyBullets;
+    BulletBatch m_enemyBullets;
+    std::vector<uint32_t> m_enemyBulletHitMasks; // Scratch for UpdateBullets, one entry per BulletBatch::LANES bullets
     std::vector<CowboyPowerup> m_powerups;
     std::vector<TemporaryAnimatedSprite> m_temporarySprites;
     std::unique_ptr<CowboyPowerup> m_heldItem; // Changed from raw pointer to unique_ptr
-    std::unordered_map<Rectangle, int, std::hash<Rectangle>> m_storeItems;
+    StoreItem m_storeItems[MAX_STORE_ITEMS];
+    int m_storeItemCount = 0;
+    uint16_t m_storeHitGrid[MAP_WIDTH][MAP_HEIGHT]; // Bit per store slot overlapping each tile
 
     // Data structures needed for game state
     std::vector<std::vector<std::pair<int, int>>> m_spawnQueue;
     std::vector<Vector2> m_monsterChances;
     int m_map[MAP_WIDTH][MAP_HEIGHT];
     int m_nextMap[MAP_WIDTH][MAP_HEIGHT]; // Add buffer for next map
+    unsigned int m_mapRevision = 1;       // Bumped by every map write so the renderer re-renders the layer
+    unsigned int m_nextMapRevision = 1;
+    TextCache m_textCache;                // Laid out labels and menu entries
+    TextRun m_livesText;                  // HUD counters, laid out again only when the value changes
+    TextRun m_coinsText;
+    TextRun m_storePriceText[MAX_STORE_ITEMS];
+    TileMask m_blockedTiles[COLLISION_LAYER_COUNT]; // Per layer, derived from m_map by RebuildPassabilityMasks
+
+    // Tiles a dropped powerup may not rest on (border ring, anything the player can't enter)
+    // send it this many tiles over to the nearest safe one the player can walk to. Zero on safe tiles
+    struct TileOffset
+    {
+        int8_t x;
+        int8_t y;
+    };
+    TileOffset m_powerupEjection[MAP_WIDTH][MAP_HEIGHT] = {};
+    bool m_powerupEjectionDirty = true; // Map changed since the field was built; rebuilt at the next drop
+    TileMask m_powerupReachable;        // Tiles the field treated as reachable; rebuilt if the player leaves them
+    FlowField m_flowField; // Distance to the player's tile for chasing monsters
+    bool m_flowFieldDirty = true;  // Whole map changed, needs a full rebuild
+    TileMask m_dirtyTiles;         // Tiles edited by SetMapTile since the last flow field update
     std::unordered_map<int, int> m_activePowerups;
 
     // Input handling
     std::unordered_set<GameKeys> m_buttonHeldState;
     std::unordered_map<GameKeys, int> m_buttonHeldFrames;
+    Vector2 m_pointer = {0.0f, 0.0f};
+    bool m_pointerPressed = false;
+    int m_screenWidth;
+    int m_screenHeight;
+    int m_fps = 0;
 
     int GetTileSize() const { return BASE_TILE_SIZE * PIXEL_ZOOM; }
 
     // Debug mode variables and functions
     bool m_debugMode = false;
     bool m_isPaused = false;
-    void DrawDebugInfo();
+    void DrawDebugInfo(DrawList &list);
+    void DrawDebugText(DrawList &list, const char *text, float x, float y, Color color) const;
     void HandleDebugInputs();
     void SpawnDebugMonster(int type);
     void SpawnDebugPowerup(int type);
-    void DrawDebugGrid();
+    void DrawDebugGrid(DrawList &list);
+    void DrawDebugHitboxes(DrawList &list);
     void PauseScreen();
 
     void ApplyPurchasedUpgrade(int itemId);
-    void DrawShopping(const Texture2D &texture, Vector2 topLeftScreenCoordinate);
+    void DrawShopping(DrawList &list, Vector2 topLeftScreenCoordinate);
+
+    // Draw passes. Gameplay coordinates are arena units (PIXEL_ZOOM screen pixels per
+    // sprite pixel) offset by m_topLeftScreenCoordinate; the world camera maps them onto
+    // the virtual screen and the HUD camera onto the window at the presented scale
+    bool DrawWorld(DrawList &list);
+    void DrawBullets(DrawList &list);
+    void DrawParticles(DrawList &list);
+    static bool IsInstancedParticle(const TemporaryAnimatedSprite &sprite);
+    void DrawEndCutscene(DrawList &list);
+    Camera2D GetWorldCamera() const;
+    Camera2D GetHudCamera() const;
+    void DrawShopPrices(DrawList &list, Vector2 topLeftScreenCoordinate);
+
+    // Buttons of the menu after the ending, in window pixels
+    static constexpr int END_MENU_OPTIONS = 3;
+    Rectangle GetEndMenuButton(int index) const;
+    void UpdateEndMenu();
 
     int m_pauseOption = 0;
     bool m_showPauseSettings = false;
@@ -0,0 +1,48 @@
+#pragma once
+#include "gameplay/PrairieKing.hpp"
+#include <string>
+#include <vector>
+
+// Scripted input for one run of the game, so a session can be played back tick by tick
+// without a keyboard (headless screenshot tests, benchmarks). The file is plain text:
+//
+//     # comment
+//     seed 1234
+//     30 +MoveLeft
+//     90 -MoveLeft
+//     95 +ShootUp
+//
+// "seed" feeds std::srand before the game is built (the game only uses std::rand).
+// Each event is "<tick> +Key" or "<tick> -Key" with a GameKeys name; keys stay held
+// between their + and - events, like a player holding them down. Pause toggles on its
+// + event and ignores -.
+class Replay
+{
+public:
+    bool Load(const std::string &path);
+
+    unsigned int GetSeed() const { return m_seed; }
+
+    // Tick of the last event, 0 for an empty replay
+    int GetLength() const { return m_events.empty() ? 0 : m_events.back().tick; }
+
+    // Applies every event for this tick. Call once per tick, in order, before Update
+    void Apply(PrairieKing &game, int tick);
+
+    const std::string &GetError() const { return m_error; }
+
+private:
+    struct Event
+    {
+        int tick;
+        PrairieKing::GameKeys key;
+        bool pressed;
+    };
+
+    static bool ParseKey(const std::string &name, PrairieKing::GameKeys &key);
+
+    unsigned int m_seed = 0;
+    std::vector<Event> m_events;
+    size_t m_next = 0;
+    std::string m_error;
+};
@@ -0,0 +1,57 @@
+#pragma once
+#include "gameplay/DrawList.hpp"
+#include "gameplay/PrairieKing.hpp"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+class AssetManager;
+
+// Runs PrairieKing on a worker thread. Each Step hands the worker the input for the next
+// tick and gives back the draw list of the previous one, so the main thread renders tick
+// N while the worker simulates tick N + 1 (one tick of extra latency). The lists are
+// double buffered and only swapped while the worker is idle, so neither side locks
+// while it works. GL and window input stay on the main thread, which GLFW requires.
+class SimulationThread
+{
+public:
+    // Game state the screen needs, read while the worker is idle
+    struct Status
+    {
+        bool gameOver = false;
+        bool returnToMenu = false;
+        bool closeRequested = false;
+    };
+
+    explicit SimulationThread(AssetManager &assets);
+    ~SimulationThread();
+    SimulationThread(const SimulationThread &) = delete;
+    SimulationThread &operator=(const SimulationThread &) = delete;
+
+    // Waits for the tick in flight, publishes its draw list and starts the next one
+    void Step(const PrairieKing::InputFrame &input, float deltaTime);
+
+    // Latest finished frame. Stays untouched by the worker until the next Step
+    const DrawList &GetDrawList() const { return m_lists[m_front]; }
+    const Status &GetStatus() const { return m_status; }
+
+private:
+    void Run();
+
+    std::unique_ptr<PrairieKing> m_game;
+    DrawList m_lists[2];
+    int m_front = 0;
+    Status m_status;
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_wake; // Main -> worker: a tick is queued or stop
+    std::condition_variable m_done; // Worker -> main: the tick finished
+    bool m_busy = false;            // A tick is queued or running
+    bool m_ready = false;           // m_lists[1 - m_front] holds a finished frame
+    bool m_stop = false;
+
+    PrairieKing::InputFrame m_input;
+    float m_deltaTime = 0.0f;
+};
@@ -0,0 +1,111 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+// Uniform grid broadphase over the arena. Each item is bucketed by the cell of its
+// top-left corner, and queries widen their search by the largest item size seen so
+// anything overlapping the query rectangle is visited. Positions outside the grid
+// clamp to the edge cells.
+template <typename T>
+class SpatialGrid
+{
+public:
+    static constexpr int NO_CELL = -1;
+
+    SpatialGrid(int columns, int rows, float cellSize)
+        : m_columns(columns), m_rows(rows), m_cellSize(cellSize), m_maxItemSize(0.0f),
+          m_cells(static_cast<size_t>(columns * rows))
+    {
+    }
+
+    void Clear()
+    {
+        for (auto &cell : m_cells)
+        {
+            cell.clear();
+        }
+        m_maxItemSize = 0.0f;
+    }
+
+    void Insert(T *item, const Rectangle &bounds, int &cell)
+    {
+        cell = CellFor(bounds.x, bounds.y);
+        m_cells[cell].push_back(item);
+        m_maxItemSize = std::max(m_maxItemSize, std::max(bounds.width, bounds.height));
+    }
+
+    // Rebucket an item after it moved; cheap when it stays in the same cell
+    void Move(T *item, const Rectangle &bounds, int &cell)
+    {
+        int newCell = CellFor(bounds.x, bounds.y);
+        m_maxItemSize = std::max(m_maxItemSize, std::max(bounds.width, bounds.height));
+        if (newCell == cell)
+        {
+            return;
+        }
+
+        Remove(item, cell);
+        cell = newCell;
+        m_cells[cell].push_back(item);
+    }
+
+    void Remove(T *item, int &cell)
+    {
+        if (cell == NO_CELL)
+        {
+            return;
+        }
+
+        auto &bucket = m_cells[cell];
+        auto it = std::find(bucket.begin(), bucket.end(), item);
+        if (it != bucket.end())
+        {
+            *it = bucket.back();
+            bucket.pop_back();
+        }
+        cell = NO_CELL;
+    }
+
+    // Calls visit(item) for every item that may overlap r; stops early when visit returns true
+    template <typename Visitor>
+    bool Query(const Rectangle &r, Visitor visit) const
+    {
+        int minX = ClampColumn(static_cast<int>(std::floor((r.x - m_maxItemSize) / m_cellSize)));
+        int minY = ClampRow(static_cast<int>(std::floor((r.y - m_maxItemSize) / m_cellSize)));
+        int maxX = ClampColumn(static_cast<int>(std::floor((r.x + r.width) / m_cellSize)));
+        int maxY = ClampRow(static_cast<int>(std::floor((r.y + r.height) / m_cellSize)));
+
+        for (int y = minY; y <= maxY; y++)
+        {
+            for (int x = minX; x <= maxX; x++)
+            {
+                for (T *item : m_cells[y * m_columns + x])
+                {
+                    if (visit(item))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+private:
+    int ClampColumn(int x) const { return std::min(std::max(x, 0), m_columns - 1); }
+    int ClampRow(int y) const { return std::min(std::max(y, 0), m_rows - 1); }
+
+    int CellFor(float x, float y) const
+    {
+        return ClampRow(static_cast<int>(std::floor(y / m_cellSize))) * m_columns +
+               ClampColumn(static_cast<int>(std::floor(x / m_cellSize)));
+    }
+
+    int m_columns;
+    int m_rows;
+    float m_cellSize;
+    float m_maxItemSize;
+    std::vector<std::vector<T *>> m_cells;
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+#include <vector>
+
+// Depth sorted sprite queue for one atlas. Sprites are queued during the frame with a
+// layer depth (lower is further back, same as the original layerDepth values), then
+// Flush() radix sorts them and submits every quad under a single texture bind, so the
+// world is drawn in one batch instead of one DrawTexturePro per sprite. Sprites with
+// equal depth keep the order they were added in.
+class SpriteBatch
+{
+public:
+    void Add(const Rectangle &source, const Rectangle &dest, float depth,
+             Color tint = WHITE, float rotation = 0.0f, bool flipX = false)
+    {
+        m_sprites.push_back(Sprite{source, dest, tint, rotation, flipX});
+        m_keys.push_back(DepthKey(depth));
+    }
+
+    void Clear()
+    {
+        m_sprites.clear();
+        m_keys.clear();
+    }
+
+    size_t Size() const { return m_sprites.size(); }
+    bool Empty() const { return m_sprites.empty(); }
+
+    // Draws the queued sprites back to front and clears the queue
+    void Flush(const Texture2D &atlas);
+
+    // Draws only the sprites with depth below maxDepth and keeps the rest queued, so
+    // something drawn outside the batch can be slotted in between depth ranges
+    void FlushBelow(const Texture2D &atlas, float maxDepth);
+
+private:
+    struct Sprite
+    {
+        Rectangle source;
+        Rectangle dest;
+        Color tint;
+        float rotation;
+        bool flipX;
+    };
+
+    // Maps a float to an unsigned key with the same ordering (negatives included)
+    static uint32_t DepthKey(float depth);
+
+    void SortByDepth();
+    void Submit(const Texture2D &atlas, size_t count) const;
+
+    std::vector<Sprite> m_sprites;
+    std::vector<uint32_t> m_keys;
+
+    // Radix sort scratch, kept between frames to avoid reallocating
+    std::vector<uint32_t> m_order;
+    std::vector<uint32_t> m_scratch;
+};
@@ -0,0 +1,58 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+
+// Draws many copies of one atlas sprite with a single instanced call on GL 3.3+.
+// Each instance only carries its top-left position and animation frame (frames step
+// right across the atlas by the source width); the quad, source rect and size are
+// shared. On GL 2.1 / ES2, where instancing isn't available, Draw falls back to
+// raylib's regular batcher with one DrawTexturePro per instance.
+class SpriteInstancer
+{
+public:
+    SpriteInstancer() = default;
+    ~SpriteInstancer();
+    SpriteInstancer(const SpriteInstancer &) = delete;
+    SpriteInstancer &operator=(const SpriteInstancer &) = delete;
+
+    void Add(Vector2 position, int frame = 0)
+    {
+        m_instances.push_back(Instance{position.x, position.y, static_cast<float>(frame)});
+    }
+
+    void Clear() { m_instances.clear(); }
+    bool Empty() const { return m_instances.empty(); }
+
+    // Draws the queued instances in the current 2D mode and clears the queue
+    void Draw(const Texture2D &atlas, const Rectangle &source, Vector2 size, Color tint = WHITE);
+
+    // False when the GL context can't do instancing and the batcher fallback is used
+    bool IsInstanced();
+
+private:
+    struct Instance
+    {
+        float x;
+        float y;
+        float frame;
+    };
+
+    void Load();
+    void ReserveBuffer(size_t count);
+    void DrawInstanced(const Texture2D &atlas, const Rectangle &source, Vector2 size, Color tint);
+    void DrawBatched(const Texture2D &atlas, const Rectangle &source, Vector2 size, Color tint) const;
+
+    std::vector<Instance> m_instances;
+
+    bool m_loaded = false;
+    bool m_instanced = false;
+    unsigned int m_shader = 0;
+    unsigned int m_vertexArray = 0;
+    unsigned int m_quadBuffer = 0;
+    unsigned int m_instanceBuffer = 0;
+    size_t m_instanceCapacity = 0;
+    int m_mvpLocation = -1;
+    int m_sourceLocation = -1;
+    int m_sizeLocation = -1;
+    int m_tintLocation = -1;
+};
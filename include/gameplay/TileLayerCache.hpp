@@ -0,0 +1,65 @@
+#pragma once
+#include "raylib.h"
+
+// Static tile layer of one map pre-rendered at native resolution (16x16 tiles of 16px),
+// one render texture per animation frame. It is only re-rendered after Invalidate() or
+// when the world (tile row in the sheet) changes, so drawing it is a single quad.
+class TileLayerCache
+{
+public:
+    static constexpr int SIZE = 16;
+    static constexpr int TILE_PIXELS = 16;
+    static constexpr int FRAMES = 2;
+
+    TileLayerCache() = default;
+    ~TileLayerCache();
+    TileLayerCache(const TileLayerCache &) = delete;
+    TileLayerCache &operator=(const TileLayerCache &) = delete;
+
+    void Invalidate() { m_dirty = true; }
+
+    // sourceRect(tileType, frame) picks the sprite for a tile. Call outside any other
+    // BeginTextureMode block, since render targets don't nest
+    template <typename SourceRect>
+    void Refresh(const Texture2D &tiles, const int (&map)[SIZE][SIZE], int world, SourceRect sourceRect)
+    {
+        if (!m_loaded)
+        {
+            Load();
+        }
+        if (!m_dirty && world == m_world)
+        {
+            return;
+        }
+
+        for (int frame = 0; frame < FRAMES; frame++)
+        {
+            BeginTextureMode(m_frames[frame]);
+            ClearBackground(BLANK);
+            for (int x = 0; x < SIZE; x++)
+            {
+                for (int y = 0; y < SIZE; y++)
+                {
+                    DrawTextureRec(tiles, sourceRect(map[x][y], frame),
+                                   Vector2{static_cast<float>(x * TILE_PIXELS), static_cast<float>(y * TILE_PIXELS)},
+                                   WHITE);
+                }
+            }
+            EndTextureMode();
+        }
+
+        m_dirty = false;
+        m_world = world;
+    }
+
+    // Draws the whole layer with its top-left at position (rounded to whole pixels)
+    void Draw(Vector2 position, float scale, int frame) const;
+
+private:
+    void Load();
+
+    RenderTexture2D m_frames[FRAMES] = {};
+    bool m_loaded = false;
+    bool m_dirty = true;
+    int m_world = -1;
+};
@@ -0,0 +1,203 @@
+#pragma once
+#include <cstdint>
+
+// Set of tiles on the 16x16 arena, one uint16_t per row (bit x = column x)
+struct TileMask
+{
+    static constexpr int SIZE = 16;
+
+    uint16_t rows[SIZE] = {};
+
+    static constexpr bool InBounds(int x, int y)
+    {
+        return x >= 0 && x < SIZE && y >= 0 && y < SIZE;
+    }
+
+    constexpr bool Test(int x, int y) const
+    {
+        return InBounds(x, y) && ((rows[y] >> x) & 1u) != 0;
+    }
+
+    constexpr void Set(int x, int y)
+    {
+        if (InBounds(x, y))
+        {
+            rows[y] = static_cast<uint16_t>(rows[y] | (1u << x));
+        }
+    }
+
+    constexpr void Reset(int x, int y)
+    {
+        if (InBounds(x, y))
+        {
+            rows[y] = static_cast<uint16_t>(rows[y] & ~(1u << x));
+        }
+    }
+
+    constexpr void Clear()
+    {
+        for (int y = 0; y < SIZE; y++)
+        {
+            rows[y] = 0;
+        }
+    }
+
+    constexpr bool Any() const
+    {
+        for (int y = 0; y < SIZE; y++)
+        {
+            if (rows[y] != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    constexpr int Count() const
+    {
+        int count = 0;
+        for (int y = 0; y < SIZE; y++)
+        {
+            for (uint16_t bits = rows[y]; bits != 0; bits = static_cast<uint16_t>(bits & (bits - 1)))
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    // True if any tile inside [minX..maxX] x [minY..maxY] is in the set (bounds are clamped)
+    constexpr bool AnyInRect(int minX, int minY, int maxX, int maxY) const
+    {
+        if (minX < 0)
+            minX = 0;
+        if (minY < 0)
+            minY = 0;
+        if (maxX >= SIZE)
+            maxX = SIZE - 1;
+        if (maxY >= SIZE)
+            maxY = SIZE - 1;
+        if (minX > maxX || minY > maxY)
+        {
+            return false;
+        }
+
+        uint16_t columns = static_cast<uint16_t>((0xFFFFu >> (SIZE - 1 - (maxX - minX))) << minX);
+        for (int y = minY; y <= maxY; y++)
+        {
+            if ((rows[y] & columns) != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Position of the n-th set tile in row-major order, false if there are fewer than n + 1
+    constexpr bool Nth(int n, int &outX, int &outY) const
+    {
+        for (int y = 0; y < SIZE; y++)
+        {
+            for (int x = 0; x < SIZE; x++)
+            {
+                if (((rows[y] >> x) & 1u) != 0 && n-- == 0)
+                {
+                    outX = x;
+                    outY = y;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Calls fn(x, y) for every tile in the set, row by row
+    template <typename Fn>
+    void ForEach(Fn fn) const
+    {
+        for (int y = 0; y < SIZE; y++)
+        {
+            for (uint16_t bits = rows[y]; bits != 0; bits = static_cast<uint16_t>(bits & (bits - 1)))
+            {
+                int x = 0;
+                while (((bits >> x) & 1u) == 0)
+                {
+                    x++;
+                }
+                fn(x, y);
+            }
+        }
+    }
+
+    constexpr TileMask &operator|=(const TileMask &other)
+    {
+        for (int y = 0; y < SIZE; y++)
+        {
+            rows[y] = static_cast<uint16_t>(rows[y] | other.rows[y]);
+        }
+        return *this;
+    }
+
+    constexpr TileMask &operator&=(const TileMask &other)
+    {
+        for (int y = 0; y < SIZE; y++)
+        {
+            rows[y] = static_cast<uint16_t>(rows[y] & other.rows[y]);
+        }
+        return *this;
+    }
+
+    constexpr TileMask operator~() const
+    {
+        TileMask result;
+        for (int y = 0; y < SIZE; y++)
+        {
+            result.rows[y] = static_cast<uint16_t>(~rows[y]);
+        }
+        return result;
+    }
+
+    friend constexpr TileMask operator|(TileMask lhs, const TileMask &rhs) { return lhs |= rhs; }
+    friend constexpr TileMask operator&(TileMask lhs, const TileMask &rhs) { return lhs &= rhs; }
+
+    friend constexpr bool operator==(const TileMask &lhs, const TileMask &rhs)
+    {
+        for (int y = 0; y < SIZE; y++)
+        {
+            if (lhs.rows[y] != rhs.rows[y])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend constexpr bool operator!=(const TileMask &lhs, const TileMask &rhs) { return !(lhs == rhs); }
+
+    // Filled rectangle of tiles
+    static constexpr TileMask FromRect(int x, int y, int width, int height)
+    {
+        TileMask mask;
+        for (int ty = y; ty < y + height; ty++)
+        {
+            for (int tx = x; tx < x + width; tx++)
+            {
+                mask.Set(tx, ty);
+            }
+        }
+        return mask;
+    }
+
+    // One tile thick outline of a rectangle
+    static constexpr TileMask Outline(int x, int y, int width, int height)
+    {
+        TileMask mask = FromRect(x, y, width, height);
+        if (width > 2 && height > 2)
+        {
+            TileMask inner = FromRect(x + 1, y + 1, width - 2, height - 2);
+            mask &= ~inner;
+        }
+        return mask;
+    }
+};
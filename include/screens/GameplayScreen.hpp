@@ -1,18 +1,21 @@
 #pragma once
 #include "Screen.hpp"
+#include "gameplay/DrawListRenderer.hpp"
 #include <memory>
 
-// Forward declare PrairieKing class
-class PrairieKing;
+// Forward declare the simulation, which owns the PrairieKing instance
+class SimulationThread;
 
 class GameplayScreen : public Screen {
 public:
-    GameplayScreen(AssetManager& assets, const Vector2& pixelScale);
+    GameplayScreen(AssetManager& assets);
+    ~GameplayScreen();
     
     virtual void Update(float deltaTime) override;
     virtual void Draw() override;
     virtual bool IsFinished() const override;
 
 private:
-    std::unique_ptr<PrairieKing> m_game;
+    std::unique_ptr<SimulationThread> m_sim;
+    DrawListRenderer m_renderer;
 };
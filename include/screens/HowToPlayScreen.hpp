@@ -3,7 +3,7 @@
 
 class HowToPlayScreen : public Screen {
 public:
-    HowToPlayScreen(AssetManager& assets, const Vector2& pixelScale);
+    HowToPlayScreen(AssetManager& assets);
     void Update(float deltaTime) override;
     void Draw() override;
 
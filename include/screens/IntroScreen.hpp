@@ -3,7 +3,7 @@
 
 class IntroScreen : public Screen {
 public:
-    IntroScreen(AssetManager& assets, const Vector2& pixelScale);
+    IntroScreen(AssetManager& assets);
     void Update(float deltaTime) override;
     void Draw() override;
 
@@ -31,11 +31,5 @@ private:
     static constexpr float FADE_OUT_TIME = 1.0f;
     static constexpr float BLINK_INTERVAL = 0.5f;
 
-    // Add new members for logo positions
-    Rectangle m_gameLogo;
-    Rectangle m_gameLogoDest;
-    Rectangle m_pressStart;
-    Rectangle m_pressStartDest;
-    
     void DoBlinkAnimation();
 };
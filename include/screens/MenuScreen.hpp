@@ -1,9 +1,10 @@
 #pragma once
 #include "Screen.hpp"
+#include "TextCache.hpp"
 
 class MenuScreen : public Screen {
 public:
-    MenuScreen(AssetManager& assets, const Vector2& pixelScale);
+    MenuScreen(AssetManager& assets);
     void Update(float deltaTime) override;
     void Draw() override;
     int GetSelectedOption() const { return m_selectedOption; }
@@ -13,6 +14,7 @@ private:
     float m_blinkTimer;
     bool m_showPrompt;
     const float BLINK_INTERVAL = 0.5f;
+    static constexpr float OPTION_TEXT_SIZE = 13.0f; // Virtual pixels
     struct MenuOption {
         float x;
         float y;
@@ -23,4 +25,7 @@ private:
         operator Rectangle() const { return Rectangle{ x, y, width, height }; }
     };
     MenuOption GetOptionBounds(const char* text, int index) const;
+
+    // Labels are laid out once; GetOptionBounds measures through the cache too
+    mutable TextCache m_text;
 };
@@ -1,19 +1,54 @@
 #pragma once
 #include "AssetManager.hpp"
+#include "VirtualScreen.hpp"
 #include "raylib.h"
 
 class Screen {
 public:
-    Screen(AssetManager& assets, const Vector2& pixelScale) 
-        : m_assets(assets), m_pixelScale(pixelScale), m_isFinished(false) {}
+    Screen(AssetManager& assets)
+        : m_assets(assets), m_isFinished(false), m_quitRequested(false) {}
     virtual ~Screen() = default;
     
     virtual void Update(float deltaTime) = 0;
     virtual void Draw() = 0;
     virtual bool IsFinished() const { return m_isFinished; }
+    // The player asked to leave the game; the application closes the window, screens never do
+    bool IsQuitRequested() const { return m_quitRequested; }
 
 protected:
+    // Screen pixels per virtual pixel, the whole-number scale the arena is shown at. Read
+    // every frame so it follows window resizes; screens size and place everything in
+    // virtual pixels times this, so the menus scale with the arena
+    static float GetPixelScale() { return static_cast<float>(VirtualScreen::GetScale()); }
+
+    // The title logo and its "press start" prompt, at two virtual pixels per sprite pixel.
+    // The intro and the main menu share them so the logo doesn't jump between the two
+    static constexpr Rectangle TITLE_LOGO_SOURCE = { 0, 96, 96, 56 };
+    static constexpr Rectangle PRESS_START_SOURCE = { 24, 155, 49, 7 };
+    static constexpr float TITLE_ZOOM = 2.0f;
+
+    static Rectangle GetTitleLogoDest() {
+        const float px = GetPixelScale();
+        const float width = TITLE_LOGO_SOURCE.width * TITLE_ZOOM * px;
+        const float height = TITLE_LOGO_SOURCE.height * TITLE_ZOOM * px;
+        return Rectangle{ (GetScreenWidth() - width) / 2.0f, (GetScreenHeight() - height) / 2.0f - 16 * px,
+                          width, height };
+    }
+
+    // Also where the main menu puts its options
+    static float GetBelowTitleY() {
+        const float px = GetPixelScale();
+        return GetScreenHeight() / 2.0f + TITLE_LOGO_SOURCE.height * TITLE_ZOOM * px / 2.0f + 10 * px;
+    }
+
+    static Rectangle GetPressStartDest() {
+        const float px = GetPixelScale();
+        const float width = PRESS_START_SOURCE.width * TITLE_ZOOM * px;
+        const float height = PRESS_START_SOURCE.height * TITLE_ZOOM * px;
+        return Rectangle{ (GetScreenWidth() - width) / 2.0f, GetBelowTitleY(), width, height };
+    }
+
     AssetManager& m_assets;
-    Vector2 m_pixelScale;
     bool m_isFinished;
+    bool m_quitRequested;
 };
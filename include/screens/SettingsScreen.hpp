@@ -1,5 +1,7 @@
 #pragma once
 #include "Screen.hpp"
+#include "TextCache.hpp"
+#include "FramePacer.hpp"
 
 enum class DisplayMode {
     FULLSCREEN,
@@ -9,7 +11,7 @@ enum class DisplayMode {
 
 class SettingsScreen : public Screen {
 public:
-    SettingsScreen(AssetManager& assets, const Vector2& pixelScale);
+    SettingsScreen(AssetManager& assets);
     void Update(float deltaTime) override;
     void Draw() override;
 
@@ -17,11 +19,17 @@ private:
     void ToggleFullscreenMode();
     DisplayMode GetDisplayMode();
     void CycleDisplayMode();
+    void CycleFrameTarget(int direction);
 
     DisplayMode m_displayMode;
     int m_selectedOption;
+    static constexpr int OPTION_COUNT = 4;
     int m_volume;
     float m_blinkTimer;
     bool m_showPrompt;
     static constexpr float BLINK_INTERVAL = 0.5f;
+
+    // Title and option labels, laid out again only when their text changes
+    TextRun m_titleText;
+    TextRun m_optionText[OPTION_COUNT];
 };
@@ -0,0 +1,139 @@
+#include "AssetArchive.hpp"
+#include <algorithm>
+#include <cstring>
+
+// No raylib here: windows.h and raylib.h can't share a translation unit
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+    // Maps the whole file read-only. The mapping outlives the file handle
+    const unsigned char* MapFile(const char* path, size_t& size) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return nullptr;
+        }
+        LARGE_INTEGER fileSize = {};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            return nullptr;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            return nullptr;
+        }
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (view == nullptr) {
+            return nullptr;
+        }
+        size = static_cast<size_t>(fileSize.QuadPart);
+        return static_cast<const unsigned char*>(view);
+#else
+        int fd = open(path, O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+        struct stat info = {};
+        if (fstat(fd, &info) != 0 || info.st_size == 0) {
+            close(fd);
+            return nullptr;
+        }
+        void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (view == MAP_FAILED) {
+            return nullptr;
+        }
+        size = static_cast<size_t>(info.st_size);
+        return static_cast<const unsigned char*>(view);
+#endif
+    }
+
+    void UnmapFile(const unsigned char* data, size_t size) {
+#if defined(_WIN32)
+        (void)size;
+        UnmapViewOfFile(data);
+#else
+        munmap(const_cast<unsigned char*>(data), size);
+#endif
+    }
+}
+
+AssetArchive::~AssetArchive() {
+    Close();
+}
+
+bool AssetArchive::Open(const char* path) {
+    Close();
+
+    size_t size = 0;
+    const unsigned char* data = MapFile(path, size);
+    if (data == nullptr) {
+        return false;
+    }
+
+    // Validate everything once here, so Find can trust the index
+    using namespace ArchiveFormat;
+    bool valid = size >= sizeof(Header);
+    const Header* header = reinterpret_cast<const Header*>(data);
+    valid = valid && std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) == 0 && header->version == VERSION;
+    valid = valid && header->count <= (size - sizeof(Header)) / sizeof(Entry);
+
+    const Entry* entries = reinterpret_cast<const Entry*>(data + sizeof(Header));
+    for (uint32_t i = 0; valid && i < header->count; i++) {
+        const Entry& entry = entries[i];
+        valid = entry.offset <= size && entry.size <= size - entry.offset &&
+                std::memchr(entry.path, '\0', MAX_PATH_LENGTH) != nullptr &&
+                (i == 0 || std::strcmp(entries[i - 1].path, entry.path) < 0);
+    }
+
+    if (!valid) {
+        UnmapFile(data, size);
+        return false;
+    }
+
+    m_data = data;
+    m_size = size;
+    m_entries = entries;
+    m_count = header->count;
+    return true;
+}
+
+void AssetArchive::Close() {
+    if (m_data != nullptr) {
+        UnmapFile(m_data, m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_entries = nullptr;
+    m_count = 0;
+}
+
+const unsigned char* AssetArchive::Find(const char* path, size_t& size) const {
+    if (m_data == nullptr) {
+        return nullptr;
+    }
+
+    const ArchiveFormat::Entry* end = m_entries + m_count;
+    const ArchiveFormat::Entry* entry = std::lower_bound(m_entries, end, path,
+        [](const ArchiveFormat::Entry& candidate, const char* key) {
+            return std::strcmp(candidate.path, key) < 0;
+        });
+    if (entry == end || std::strcmp(entry->path, path) != 0) {
+        return nullptr;
+    }
+
+    size = static_cast<size_t>(entry->size);
+    return m_data + entry->offset;
+}
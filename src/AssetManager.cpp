@@ -1,157 +1,308 @@
 #include "AssetManager.hpp"
-#include "JsonHelper.hpp"
+#include "StartupTrace.hpp"
+#include "generated/AtlasLayout.hpp"
+#include "generated/FontMetrics.hpp"
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+namespace {
+    // Indexed by TextureId / SoundId / FontId; the name is what the string lookups accept
+    struct AssetFile {
+        const char* name;
+        const char* path;
+    };
+
+    // cursors_1.png and both font sheets are packed into one atlas by AtlasPacker at build
+    // time, with room left for raylib's default font, so text, shapes and sprites share a texture
+    constexpr AssetFile TEXTURE_FILES[] = {
+        { "cursors", AtlasLayout::IMAGE_PATH },
+    };
+
+    // Sprite rects all over the gameplay code are relative to cursors_1.png
+    static_assert(AtlasLayout::CURSORS.x == 0 && AtlasLayout::CURSORS.y == 0, "The cursors sheet must sit at the atlas origin");
+
+    constexpr AssetFile SOUND_FILES[] = {
+        { "pickup_coin", "sounds/Pickup_Coin15.wav" },
+        { "cowboy_gunshot", "sounds/Cowboy_gunshot.wav" },
+        { "cowboy_dead", "sounds/cowboy_dead.wav" },
+        { "cowboy_powerup", "sounds/cowboy_powerup.wav" },
+        { "cowboy_explosion", "sounds/cowboy_explosion.wav" },
+        { "cowboy_footstep", "sounds/Cowboy_Footstep.wav" },
+        { "cowboy_monsterhit", "sounds/cowboy_monsterhit.wav" },
+        { "cowboy_gopher", "sounds/cowboy_gopher.wav" },
+        { "cowboy_singing", "sounds/cowboy_singing.wav" },
+        { "cowboy_secret", "sounds/Cowboy_Secret.wav" },
+        { "outlaw_dead", "sounds/dead.wav" },
+        { "cowboy_gunload", "sounds/cowboy_gunload.wav" },
+        { "cowboy_monsterdie", nullptr },
+        { "cowboy_boss", nullptr },
+    };
+
+    constexpr const char* FONT_NAMES[] = { "title", "text", "small" };
+
+    static_assert(sizeof(TEXTURE_FILES) / sizeof(TEXTURE_FILES[0]) == static_cast<size_t>(TextureId::Count), "One file per TextureId");
+    static_assert(sizeof(SOUND_FILES) / sizeof(SOUND_FILES[0]) == static_cast<size_t>(SoundId::Count), "One file per SoundId");
+    static_assert(sizeof(FONT_NAMES) / sizeof(FONT_NAMES[0]) == static_cast<size_t>(FontId::Count), "One name per FontId");
+
+    // raylib only builds its default font along with the window, so the packer can't and
+    // its region is filled here, on the main thread, before the atlas goes to the GPU
+    void DrawDefaultFont(Image& atlas) {
+        Image sheet = LoadImageFromTexture(GetFontDefault().texture);
+        if (sheet.width > AtlasLayout::DEFAULT_FONT.width || sheet.height > AtlasLayout::DEFAULT_FONT.height) {
+            TraceLog(LOG_WARNING, "ASSETS: Default font doesn't fit its atlas region");
+        }
+        else {
+            const Rectangle source = { 0, 0, static_cast<float>(sheet.width), static_cast<float>(sheet.height) };
+            const Rectangle dest = { AtlasLayout::DEFAULT_FONT.x, AtlasLayout::DEFAULT_FONT.y, source.width, source.height };
+            ImageDraw(&atlas, sheet, source, dest, WHITE);
+        }
+        UnloadImage(sheet);
+    }
+
+    // Moves a font's glyph rects from its own sheet to where the packer put that sheet
+    void OffsetGlyphRects(Font& font, const Rectangle& region) {
+        for (int i = 0; i < font.glyphCount; i++) {
+            font.recs[i].x += region.x;
+            font.recs[i].y += region.y;
+        }
+    }
+
+    // Copies metrics FontConverter baked at build time into a font that samples the atlas
+    Font LoadBakedFont(int baseSize, const GlyphInfo (&glyphs)[FontMetrics::GLYPH_COUNT],
+                       const Rectangle (&recs)[FontMetrics::GLYPH_COUNT], const Texture2D& atlas,
+                       const Rectangle& region) {
+        Font font = { 0 };
+        font.baseSize = baseSize;
+        font.glyphCount = FontMetrics::GLYPH_COUNT;
+        font.glyphs = (GlyphInfo *)MemAlloc(sizeof(glyphs));
+        font.recs = (Rectangle *)MemAlloc(sizeof(recs));
+        std::memcpy(font.glyphs, glyphs, sizeof(glyphs));
+        std::memcpy(font.recs, recs, sizeof(recs));
+        font.texture = atlas;
+
+        OffsetGlyphRects(font, region);
+        return font;
+    }
+
+    // Archive lookups are exact, so paths must match the file names' case
+    Image LoadArchivedImage(const AssetArchive& archive, const char* path) {
+        size_t size = 0;
+        const unsigned char* data = archive.Find(path, size);
+        if (data == nullptr) {
+            return LoadImage(path);
+        }
+        return LoadImageFromMemory(GetFileExtension(path), data, static_cast<int>(size));
+    }
+
+    Wave LoadArchivedWave(const AssetArchive& archive, const char* path) {
+        size_t size = 0;
+        const unsigned char* data = archive.Find(path, size);
+        if (data == nullptr) {
+            return LoadWave(path);
+        }
+        return LoadWaveFromMemory(GetFileExtension(path), data, static_cast<int>(size));
+    }
+
+    template <size_t N>
+    int FindAsset(const AssetFile (&files)[N], const std::string& name) {
+        for (size_t i = 0; i < N; i++) {
+            if (name == files[i].name) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+}
+
+struct AssetManager::PendingAssets {
+    const AssetArchive* archive = nullptr;
+    Image images[static_cast<int>(TextureId::Count)] = {};
+    Wave waves[static_cast<int>(SoundId::Count)] = {};
+
+    // Last LoadStage the worker finished decoding; the data for it is complete once seen
+    std::atomic<LoadStage> decoded{ LoadStage::None };
+    std::thread worker;
+};
+
+AssetManager::AssetManager() = default;
+
+AssetManager::~AssetManager() {
+    // The worker writes into m_pending, so it can't outlive it
+    if (m_pending && m_pending->worker.joinable()) {
+        m_pending->worker.join();
+    }
+}
+
+// Only file reads and decoding here, no GL or audio device calls: those wait for PollLoading
+void AssetManager::DecodeAssets(PendingAssets& pending) {
+    for (int i = 0; i < static_cast<int>(TextureId::Count); i++) {
+        pending.images[i] = LoadArchivedImage(*pending.archive, TEXTURE_FILES[i].path);
+    }
+    StartupTrace::Mark("atlas decoded");
+    pending.decoded.store(LoadStage::Graphics, std::memory_order_release);
+
+    for (int i = 0; i < static_cast<int>(SoundId::Count); i++) {
+        if (SOUND_FILES[i].path != nullptr) {
+            pending.waves[i] = LoadArchivedWave(*pending.archive, SOUND_FILES[i].path);
+        }
+    }
+    StartupTrace::Mark("sounds decoded");
+    pending.decoded.store(LoadStage::Complete, std::memory_order_release);
+}
 
 void AssetManager::LoadAssets() {
-    InitAudioDevice();
-    
-    // Load textures
-    m_textures["cursors"] = LoadTexture("cursors/cursors_1.png");
-    
-    // Load sounds
-    m_sounds["pickup_coin"] = LoadSound("sounds/Pickup_Coin15.wav");
-    SetSoundPitch(m_sounds["pickup_coin"], 0.95f);
-    
-    m_sounds["cowboy_gunshot"] = LoadSound("sounds/cowboy_gunshot.wav");
-    m_sounds["cowboy_dead"] = LoadSound("sounds/cowboy_dead.wav"); 
-    m_sounds["cowboy_powerup"] = LoadSound("sounds/cowboy_powerup.wav");
-    m_sounds["cowboy_explosion"] = LoadSound("sounds/cowboy_explosion.wav");
-    m_sounds["cowboy_footstep"] = LoadSound("sounds/cowboy_footstep.wav");
-    m_sounds["cowboy_monsterhit"] = LoadSound("sounds/cowboy_monsterhit.wav");
-    m_sounds["cowboy_gopher"] = LoadSound("sounds/cowboy_gopher.wav");
-    m_sounds["cowboy_singing"] = LoadSound("sounds/cowboy_singing.wav");
-    m_sounds["cowboy_secret"] = LoadSound("sounds/cowboy_secret.wav");
-    m_sounds["outlaw_dead"] = LoadSound("sounds/dead.wav");
-    
-    // Load music streams
-    LoadMusic("overworld", "music/Cowboy_OVERWORLD.wav");
-    LoadMusic("outlaw", "music/cowboy_outlawsong.wav"); 
-    LoadMusic("zombie", "music/Cowboy_undead.wav");
-    LoadMusic("dracula", "music/cowboy_boss.wav");
-    LoadMusic("ending", "music/Cowboy_singing.wav");
-    
-    // Set default volumes
-    for (auto& [name, music] : m_music) {
-        SetMusicVolume(music, 0.7f);
+    m_archive.Open(AssetArchive::DEFAULT_PATH);
+    m_pending = std::make_unique<PendingAssets>();
+    m_pending->archive = &m_archive;
+    DecodeAssets(*m_pending);
+    PollLoading();
+}
+
+void AssetManager::StartLoading() {
+    // The one file open of the whole load; the worker only reads the mapping
+    if (m_archive.Open(AssetArchive::DEFAULT_PATH)) {
+        StartupTrace::Mark("asset archive mapped");
     }
-    
-    // Cargar fuentes
-    LoadFonts();
+    m_pending = std::make_unique<PendingAssets>();
+    m_pending->archive = &m_archive;
+    m_pending->worker = std::thread(&AssetManager::DecodeAssets, std::ref(*m_pending));
 }
 
-void AssetManager::LoadFonts() {
-    // Cargar datos de los JSON
-    FontData spriteFontData = JsonHelper::LoadFontData("fonts/SpriteFont1/SpriteFont1.json");
-    FontData smallFontData = JsonHelper::LoadFontData("fonts/SmallFont/SmallFont.json");
+void AssetManager::PollLoading() {
+    if (!m_pending) {
+        return;
+    }
+    const LoadStage decoded = m_pending->decoded.load(std::memory_order_acquire);
+
+    if (m_stage < LoadStage::Graphics && decoded >= LoadStage::Graphics) {
+        DrawDefaultFont(m_pending->images[static_cast<int>(TextureId::Cursors)]);
+        for (int i = 0; i < static_cast<int>(TextureId::Count); i++) {
+            m_textures[i] = LoadTextureFromImage(m_pending->images[i]);
+            SetTextureFilter(m_textures[i], TEXTURE_FILTER_POINT);
+            UnloadImage(m_pending->images[i]);
+            m_pending->images[i] = {};
+        }
 
-    // Cargar texturas directamente
-    Texture2D titleAtlas = LoadTexture("fonts/SpriteFont1/SpriteFont1.png");
-    Texture2D textAtlas = LoadTexture("fonts/SmallFont/SmallFont.png");
+        // DrawRectangle and friends sample a white texel of the atlas instead of raylib's own texture
+        SetShapesTexture(GetTexture(TextureId::Cursors), AtlasLayout::WHITE_TEXEL);
 
-    // Configurar la fuente de título
-    {
-        Font titleFont = { 0 };
-        titleFont.baseSize = spriteFontData.verticalLineSpacing;
-        titleFont.glyphCount = 256;
-        titleFont.glyphs = (GlyphInfo *)MemAlloc(titleFont.glyphCount * sizeof(GlyphInfo));
-        titleFont.recs = (Rectangle *)MemAlloc(titleFont.glyphCount * sizeof(Rectangle));
-        titleFont.texture = titleAtlas;
-
-        // Inicializar todos los glifos con valores por defecto
-        for (int i = 0; i < titleFont.glyphCount; i++) {
-            titleFont.glyphs[i].value = i;
-            titleFont.glyphs[i].offsetX = 0;
-            titleFont.glyphs[i].offsetY = 0;
-            titleFont.glyphs[i].advanceX = spriteFontData.verticalLineSpacing/2;  // Valor por defecto razonable
-
-            titleFont.recs[i] = Rectangle{0, 0, 0, 0};
-        }
-
-        // Configurar los glifos usando el mapa de caracteres
-        for (const auto& pair : spriteFontData.characters) {
-            char c = pair.first;
-            const auto& glyphData = pair.second;
-            int i = (int)c;
-
-            if (i >= 0 && i < titleFont.glyphCount) {
-                titleFont.glyphs[i].value = i;
-                titleFont.glyphs[i].offsetX = glyphData.cropX;
-                titleFont.glyphs[i].offsetY = glyphData.cropY;
-                // Aumentar el espaciado entre caracteres
-                titleFont.glyphs[i].advanceX = glyphData.cropWidth + spriteFontData.horizontalSpacing + 4; // Añadido +6 para más espacio
-
-                titleFont.recs[i].x = (float)glyphData.texX;
-                titleFont.recs[i].y = (float)glyphData.texY;
-                titleFont.recs[i].width = (float)glyphData.texWidth;
-                titleFont.recs[i].height = (float)glyphData.texHeight;
+        // Cargar fuentes
+        LoadFonts();
+
+        m_stage = LoadStage::Graphics;
+        StartupTrace::Mark("atlas and fonts uploaded");
+    }
+
+    if (m_stage < LoadStage::Complete && decoded >= LoadStage::Complete) {
+        if (m_pending->worker.joinable()) {
+            m_pending->worker.join();
+        }
+
+        InitAudioDevice();
+
+        // Load sounds
+        for (int i = 0; i < static_cast<int>(SoundId::Count); i++) {
+            if (m_pending->waves[i].data != nullptr) {
+                m_sounds[i] = LoadSoundFromWave(m_pending->waves[i]);
+                UnloadWave(m_pending->waves[i]);
             }
         }
+        SetSoundPitch(GetSound(SoundId::PickupCoin), 0.95f);
+
+        // Music is streamed, opening it only reads the header
+        LoadMusic("overworld", "music/Cowboy_OVERWORLD.wav");
+        LoadMusic("outlaw", "music/cowboy_outlawsong.wav"); 
+        LoadMusic("zombie", "music/Cowboy_undead.wav");
+        LoadMusic("dracula", "music/cowboy_boss.wav");
+        LoadMusic("ending", "music/Cowboy_singing.wav");
+        
+        // Set default volumes
+        for (auto& [name, music] : m_music) {
+            SetMusicVolume(music, 0.7f);
+        }
 
-        m_fonts["title"] = titleFont;
+        m_pending.reset();
+        m_stage = LoadStage::Complete;
+        StartupTrace::Mark("sounds and music uploaded");
     }
+}
+
+void AssetManager::LoadFonts() {
+    // Las fuentes usan el atlas compartido
+    const Texture2D& atlas = GetTexture(TextureId::Cursors);
 
-    // Configurar la fuente pequeña
+    // Métricas generadas por FontConverter a partir de los JSON
+    m_fonts[static_cast<int>(FontId::Title)] = LoadBakedFont(FontMetrics::TITLE_BASE_SIZE, FontMetrics::TITLE_GLYPHS,
+                                                             FontMetrics::TITLE_RECS, atlas, AtlasLayout::TITLE_FONT);
+    m_fonts[static_cast<int>(FontId::Text)] = LoadBakedFont(FontMetrics::TEXT_BASE_SIZE, FontMetrics::TEXT_GLYPHS,
+                                                            FontMetrics::TEXT_RECS, atlas, AtlasLayout::TEXT_FONT);
+
+    // Copia de la fuente por defecto de raylib apuntando a su hueco en el atlas
     {
-        Font textFont = { 0 };
-        textFont.baseSize = smallFontData.verticalLineSpacing;
-        textFont.glyphCount = 256;  // Aumentamos el número de glifos para asegurar que caben todos los caracteres especiales
-        textFont.glyphs = (GlyphInfo *)MemAlloc(textFont.glyphCount * sizeof(GlyphInfo));
-        textFont.recs = (Rectangle *)MemAlloc(textFont.glyphCount * sizeof(Rectangle));
-        textFont.texture = textAtlas;
-
-        // Inicializar todos los glifos con valores por defecto
-        for (int i = 0; i < textFont.glyphCount; i++) {
-            textFont.glyphs[i].value = i;
-            textFont.glyphs[i].offsetX = 0;
-            textFont.glyphs[i].offsetY = 0;
-            textFont.glyphs[i].advanceX = smallFontData.verticalLineSpacing/2;
-            textFont.recs[i] = Rectangle{0, 0, 0, 0};
-        }
-
-        // Configurar los glifos usando el mapa de caracteres
-        for (size_t i = 0; i < smallFontData.characterMap.size(); i++) {
-            char c = smallFontData.characterMap[i][0];  // El primer carácter de cada string en el mapa
-            const auto& glyphData = smallFontData.characters[c];
-
-            if (i < textFont.glyphCount) {
-                textFont.glyphs[i].value = (int)c;  // Usar el valor ASCII del carácter
-                textFont.glyphs[i].offsetX = glyphData.cropX;
-                textFont.glyphs[i].offsetY = glyphData.cropY;
-                textFont.glyphs[i].advanceX = glyphData.cropWidth + (smallFontData.horizontalSpacing / 2);
-
-                textFont.recs[i].x = (float)glyphData.texX;
-                textFont.recs[i].y = (float)glyphData.texY;
-                textFont.recs[i].width = (float)glyphData.texWidth;
-                textFont.recs[i].height = (float)glyphData.texHeight;
-            }
+        Font defaultFont = GetFontDefault();
+        Font smallFont = defaultFont;
+        smallFont.glyphs = (GlyphInfo *)MemAlloc(smallFont.glyphCount * sizeof(GlyphInfo));
+        smallFont.recs = (Rectangle *)MemAlloc(smallFont.glyphCount * sizeof(Rectangle));
+        smallFont.texture = atlas;
+
+        for (int i = 0; i < smallFont.glyphCount; i++) {
+            smallFont.glyphs[i] = defaultFont.glyphs[i];
+            smallFont.glyphs[i].image = {};  // The pixels live in the atlas
+            smallFont.recs[i] = defaultFont.recs[i];
         }
 
-        m_fonts["text"] = textFont;
+        OffsetGlyphRects(smallFont, AtlasLayout::DEFAULT_FONT);
+        m_fonts[static_cast<int>(FontId::Small)] = smallFont;
     }
 }
 
 Font AssetManager::GetFont(const std::string& name) const {
-    auto it = m_fonts.find(name);
-    if (it != m_fonts.end()) {
-        return it->second;
+    for (int i = 0; i < static_cast<int>(FontId::Count); i++) {
+        if (name == FONT_NAMES[i]) {
+            return m_fonts[i];
+        }
     }
     return GetFontDefault();
 }
 
 void AssetManager::UnloadAssets() {
+    // Quitting during the intro: let the worker finish and drop what it decoded
+    if (m_pending) {
+        if (m_pending->worker.joinable()) {
+            m_pending->worker.join();
+        }
+        for (auto& image : m_pending->images) {
+            UnloadImage(image);
+        }
+        for (auto& wave : m_pending->waves) {
+            UnloadWave(wave);
+        }
+        m_pending.reset();
+    }
+    m_stage = LoadStage::None;
+
+    SetShapesTexture(Texture2D{}, Rectangle{});
+
     for (auto& texture : m_textures) {
-        UnloadTexture(texture.second);
+        if (texture.id > 0) {
+            UnloadTexture(texture);
+        }
+        texture = {};
     }
     for (auto& sound : m_sounds) {
-        UnloadSound(sound.second);
+        if (sound.stream.buffer != nullptr) {
+            UnloadSound(sound);
+        }
+        sound = {};
     }
-    m_textures.clear();
-    m_sounds.clear();
     
-    // Descargar fuentes
+    // Descargar fuentes (la textura es el atlas, ya descargado arriba)
     for (auto& font : m_fonts) {
-        UnloadFont(font.second);
+        MemFree(font.glyphs);
+        MemFree(font.recs);
+        font = {};
     }
-    m_fonts.clear();
     
     // Unload all music
     for (const auto& [name, music] : m_music) {
@@ -160,20 +311,21 @@ void AssetManager::UnloadAssets() {
     m_music.clear();
     
     CloseAudioDevice();
+    m_archive.Close();
 }
 
 Texture2D AssetManager::GetTexture(const std::string& name) const {
-    auto it = m_textures.find(name);
-    if (it != m_textures.end()) {
-        return it->second;
+    int index = FindAsset(TEXTURE_FILES, name);
+    if (index >= 0) {
+        return m_textures[index];
     }
     return { 0 }; // Return empty texture if not found
 }
 
 Sound AssetManager::GetSound(const std::string& name) const {
-    auto it = m_sounds.find(name);
-    if (it != m_sounds.end()) {
-        return it->second;
+    int index = FindAsset(SOUND_FILES, name);
+    if (index >= 0) {
+        return m_sounds[index];
     }
     return { 0 };
 }
@@ -183,7 +335,14 @@ Rectangle AssetManager::GetTextureRegion(const std::string& name, int x, int y,
 }
 
 void AssetManager::LoadMusic(const std::string& name, const std::string& path) {
-    m_music[name] = LoadMusicStream(path.c_str());
+    // Streams straight out of the mapping, which is why the archive outlives the music
+    size_t size = 0;
+    const unsigned char* data = m_archive.Find(path.c_str(), size);
+    if (data == nullptr) {
+        m_music[name] = LoadMusicStream(path.c_str());
+        return;
+    }
+    m_music[name] = LoadMusicStreamFromMemory(GetFileExtension(path.c_str()), data, static_cast<int>(size));
 }
 
 Music AssetManager::GetMusic(const std::string& name) const {
@@ -0,0 +1,155 @@
+#include "FramePacer.hpp"
+#include "raylib.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+FrameTarget FramePacer::s_target = FrameTarget::UNCAPPED;
+FramePacer::Clock::duration FramePacer::s_period = FramePacer::Clock::duration::zero();
+FramePacer::Clock::duration FramePacer::s_spinMargin = std::chrono::milliseconds(1);
+FramePacer::Clock::time_point FramePacer::s_deadline;
+FramePacer::Clock::time_point FramePacer::s_lastPresent;
+std::vector<float> FramePacer::s_intervals;
+size_t FramePacer::s_nextInterval = 0;
+
+namespace {
+    constexpr auto MIN_SPIN_MARGIN = std::chrono::milliseconds(1);
+    constexpr auto MAX_SPIN_MARGIN = std::chrono::milliseconds(4);
+
+    int GetTargetRate(FrameTarget target) {
+        switch (target) {
+            case FrameTarget::FPS_60: return 60;
+            case FrameTarget::FPS_120: return 120;
+            case FrameTarget::FPS_144: return 144;
+            case FrameTarget::VSYNC: return GetMonitorRefreshRate(GetCurrentMonitor());
+            default: return 0;
+        }
+    }
+}
+
+void FramePacer::SetTarget(FrameTarget target) {
+    s_target = target;
+
+    // Only one limiter at a time: raylib's would add its own coarse wait on top of ours
+    SetTargetFPS(0);
+    if (target == FrameTarget::VSYNC) {
+        SetWindowState(FLAG_VSYNC_HINT);
+    }
+    else {
+        ClearWindowState(FLAG_VSYNC_HINT);
+    }
+
+    const int rate = target == FrameTarget::VSYNC ? 0 : GetTargetRate(target);
+    s_period = rate > 0
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate))
+        : Clock::duration::zero();
+
+    // Intervals of different targets mean nothing together
+    s_deadline = Clock::time_point();
+    s_lastPresent = Clock::time_point();
+    s_intervals.clear();
+    s_nextInterval = 0;
+}
+
+const char* FramePacer::GetTargetName(FrameTarget target) {
+    switch (target) {
+        case FrameTarget::FPS_60: return "60 FPS";
+        case FrameTarget::FPS_120: return "120 FPS";
+        case FrameTarget::FPS_144: return "144 FPS";
+        case FrameTarget::UNCAPPED: return "Uncapped";
+        case FrameTarget::VSYNC: return "VSync";
+        default: return "";
+    }
+}
+
+void FramePacer::Wait() {
+    if (s_period == Clock::duration::zero()) {
+        return;
+    }
+
+    Clock::time_point now = Clock::now();
+    if (s_deadline == Clock::time_point() || now - s_deadline > s_period) {
+        s_deadline = now;
+        return;
+    }
+
+    s_deadline += s_period;
+
+    const Clock::time_point wakeUp = s_deadline - s_spinMargin;
+    if (now < wakeUp) {
+        std::this_thread::sleep_until(wakeUp);
+
+        // Keep the margin just above what the OS actually oversleeps
+        const Clock::duration overslept = Clock::now() - wakeUp;
+        if (overslept > s_spinMargin) {
+            s_spinMargin = std::min<Clock::duration>(overslept + std::chrono::microseconds(250), MAX_SPIN_MARGIN);
+        }
+        else {
+            s_spinMargin = std::max<Clock::duration>(s_spinMargin - std::chrono::microseconds(10), MIN_SPIN_MARGIN);
+        }
+    }
+
+    while (Clock::now() < s_deadline) {
+        std::this_thread::yield();
+    }
+}
+
+void FramePacer::MarkPresented() {
+    const Clock::time_point now = Clock::now();
+    if (s_lastPresent != Clock::time_point()) {
+        const float interval = std::chrono::duration<float, std::milli>(now - s_lastPresent).count();
+        if (s_intervals.size() < HISTORY) {
+            s_intervals.push_back(interval);
+        }
+        else {
+            s_intervals[s_nextInterval] = interval;
+        }
+        s_nextInterval = (s_nextInterval + 1) % HISTORY;
+    }
+    s_lastPresent = now;
+}
+
+FramePacer::Stats FramePacer::GetStats() {
+    Stats stats;
+    const int rate = GetTargetRate(s_target);
+    stats.targetMs = rate > 0 ? 1000.0 / rate : 0.0;
+    if (s_intervals.empty()) {
+        return stats;
+    }
+
+    std::vector<float> sorted = s_intervals;
+    std::sort(sorted.begin(), sorted.end());
+
+    double sum = 0.0;
+    for (float interval : sorted) {
+        sum += interval;
+        if (stats.targetMs > 0.0 && interval > stats.targetMs * 1.5) {
+            stats.late++;
+        }
+    }
+    stats.frames = static_cast<int>(sorted.size());
+    stats.meanMs = sum / stats.frames;
+
+    double variance = 0.0;
+    for (float interval : sorted) {
+        variance += (interval - stats.meanMs) * (interval - stats.meanMs);
+    }
+    stats.stdDevMs = std::sqrt(variance / stats.frames);
+    stats.minMs = sorted.front();
+    stats.maxMs = sorted.back();
+    stats.p99Ms = sorted[static_cast<size_t>(0.99 * (sorted.size() - 1) + 0.5)];
+    return stats;
+}
+
+void FramePacer::PrintStats() {
+    const Stats stats = GetStats();
+    if (stats.frames == 0) {
+        return;
+    }
+
+    std::printf("pacing: %s, last %d frames\n", GetTargetName(s_target), stats.frames);
+    std::printf("  interval ms  target %.3f  mean %.3f  sd %.3f\n", stats.targetMs, stats.meanMs, stats.stdDevMs);
+    std::printf("  interval ms  min %.3f  p99 %.3f  max %.3f  late %d\n",
+                stats.minMs, stats.p99Ms, stats.maxMs, stats.late);
+}
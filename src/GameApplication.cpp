@@ -1,6 +1,8 @@
 #include "GameApplication.hpp"
 #include "resource_dir.h"
 #include "discord/DiscordManager.hpp"
+#include "FramePacer.hpp"
+#include "StartupTrace.hpp"
 
 GameApplication::GameApplication() : m_isRunning(false) {}
 
@@ -9,12 +11,12 @@ GameApplication::~GameApplication() {
 }
 
 void GameApplication::Initialize() {
-    SetConfigFlags(FLAG_VSYNC_HINT | FLAG_WINDOW_HIGHDPI);
+    StartupTrace::Begin();
+
+    // VSync and the frame rate cap are owned by FramePacer, set up once the window exists
+    SetConfigFlags(FLAG_WINDOW_HIGHDPI);
 
     SearchAndSetResourceDir("resources");
-        
-    // Get the monitor's refresh rate for proper vsync
-    SetTargetFPS(60);
     
     // Get current monitor dimensions for fullscreen mode
     int display = GetCurrentMonitor();
@@ -29,22 +31,16 @@ void GameApplication::Initialize() {
     
     // Enable fullscreen mode
     ToggleFullscreen();
-        
-    float screenWidth = GetScreenWidth();
-    float screenHeight = GetScreenHeight();
-    m_pixelScale.x = (float)(int)(screenWidth / 320);
-    m_pixelScale.y = (float)(int)(screenHeight / 180);
-    m_pixelScale.x = m_pixelScale.y = fminf(m_pixelScale.x, m_pixelScale.y);
-    
-    m_assets.LoadAssets();
+
+    StartupTrace::Mark("window created");
+
+    // Same default as before the pacer: synced to the display
+    FramePacer::SetTarget(FrameTarget::VSYNC);
     
-    // Set point filtering for pixel art
-    Texture2D cursorsTexture = m_assets.GetTexture("cursors");
-    if (cursorsTexture.id > 0) {
-        SetTextureFilter(cursorsTexture, TEXTURE_FILTER_POINT);
-    }
+    // Decoded in the background while the intro plays, see Run
+    m_assets.StartLoading();
     
-    m_game = std::make_unique<Game>(m_assets, m_pixelScale);
+    m_game = std::make_unique<Game>(m_assets);
     m_isRunning = true;
 
     // Initialize Discord integration
@@ -52,15 +48,34 @@ void GameApplication::Initialize() {
 }
 
 void GameApplication::Run() {
+    bool firstFrame = true;
+    bool startupReported = false;
+
     while (m_isRunning && !WindowShouldClose()) {
         // Update Discord Rich Presence
         DiscordManager::Update();
+
+        // Uploads whatever the loading thread has finished since last frame
+        m_assets.PollLoading();
         
-        m_game->Update(GetFrameTime());
+        if (!m_game->Update(GetFrameTime())) {
+            break;
+        }
         m_game->Draw();
+
+        if (firstFrame) {
+            StartupTrace::Mark("first frame presented");
+            firstFrame = false;
+        }
+        if (!startupReported && m_assets.IsLoaded()) {
+            StartupTrace::Print();
+            startupReported = true;
+        }
     }
+    FramePacer::PrintStats();
     
-    // Cleanup order is important
+    // Cleanup order is important: screens (and the simulation thread, which is joined
+    // here) go before the assets they use, and the window is closed last, once
     DiscordManager::Shutdown();
     m_game.reset();
     m_assets.UnloadAssets();
@@ -0,0 +1,461 @@
+#include "HeadlessRunner.hpp"
+#include "AssetManager.hpp"
+#include "RenderStats.hpp"
+#include "resource_dir.h"
+#include "gameplay/DrawListRenderer.hpp"
+#include "gameplay/PrairieKing.hpp"
+#include "gameplay/Replay.hpp"
+#include "rlgl.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+namespace {
+    constexpr float TICK_SECONDS = 1.0f / 60.0f;
+
+    bool IsAbsolutePath(const std::string& path) {
+        return !path.empty() && (path[0] == '/' || path[0] == '\\' || (path.size() > 1 && path[1] == ':'));
+    }
+
+    // SearchAndSetResourceDir changes the working directory, so resolve user paths first
+    std::string ResolvePath(const std::string& base, const std::string& path) {
+        if (path.empty() || IsAbsolutePath(path)) {
+            return path;
+        }
+        return base + "/" + path;
+    }
+
+    std::string CaptureName(int tick) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "tick_%05d", tick);
+        return name;
+    }
+
+    bool ParseInt(const char* text, int& value) {
+        char* end = nullptr;
+        long parsed = std::strtol(text, &end, 10);
+        if (end == text || *end != '\0' || parsed < 0) {
+            return false;
+        }
+        value = static_cast<int>(parsed);
+        return true;
+    }
+
+    double Percentile(std::vector<double> values, double fraction) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        size_t index = static_cast<size_t>(fraction * (values.size() - 1) + 0.5);
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+}
+
+bool HeadlessRunner::ParseArgs(int argc, char** argv, HeadlessOptions& options) {
+    bool headless = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--headless") {
+            headless = true;
+        }
+    }
+    if (!headless) {
+        return false;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--headless") {
+            continue;
+        }
+        if (i + 1 >= argc) {
+            options.error = arg + " needs a value";
+            return true;
+        }
+
+        const char* value = argv[++i];
+        bool ok = true;
+        if (arg == "--replay") {
+            options.replayPath = value;
+        }
+        else if (arg == "--ticks") {
+            std::stringstream list(value);
+            std::string item;
+            while (ok && std::getline(list, item, ',')) {
+                int tick = 0;
+                ok = ParseInt(item.c_str(), tick);
+                options.captureTicks.push_back(tick);
+            }
+        }
+        else if (arg == "--frames") {
+            ok = ParseInt(value, options.frames);
+        }
+        else if (arg == "--out") {
+            options.outputDir = value;
+        }
+        else if (arg == "--golden") {
+            options.goldenDir = value;
+        }
+        else if (arg == "--tolerance") {
+            ok = ParseInt(value, options.tolerance);
+        }
+        else if (arg == "--max-diff") {
+            ok = ParseInt(value, options.maxDiffPixels);
+        }
+        else if (arg == "--size") {
+            ok = std::sscanf(value, "%dx%d", &options.width, &options.height) == 2 &&
+                 options.width > 0 && options.height > 0;
+        }
+        else if (arg == "--stats") {
+            options.statsPath = value;
+        }
+        else if (arg == "--horde") {
+            ok = ParseInt(value, options.horde);
+        }
+        else if (arg == "--check") {
+            options.check = value;
+            ok = options.check == "sweep";
+        }
+        else {
+            options.error = "unknown option " + arg;
+            return true;
+        }
+
+        if (!ok) {
+            options.error = "bad value for " + arg + ": " + value;
+            return true;
+        }
+    }
+
+    std::sort(options.captureTicks.begin(), options.captureTicks.end());
+    options.captureTicks.erase(std::unique(options.captureTicks.begin(), options.captureTicks.end()),
+                               options.captureTicks.end());
+    return true;
+}
+
+int HeadlessRunner::Run() {
+    if (!m_options.error.empty()) {
+        std::printf("headless: %s\n", m_options.error.c_str());
+        return 2;
+    }
+
+    const std::string cwd = GetWorkingDirectory();
+    m_options.replayPath = ResolvePath(cwd, m_options.replayPath);
+    m_options.outputDir = ResolvePath(cwd, m_options.outputDir);
+    m_options.goldenDir = ResolvePath(cwd, m_options.goldenDir);
+    m_options.statsPath = ResolvePath(cwd, m_options.statsPath);
+
+    Replay replay;
+    if (!m_options.replayPath.empty() && !replay.Load(m_options.replayPath)) {
+        std::printf("headless: %s\n", replay.GetError().c_str());
+        return 2;
+    }
+
+    int frames = m_options.frames;
+    if (frames == 0) {
+        frames = replay.GetLength() + 1;
+        if (!m_options.captureTicks.empty()) {
+            frames = std::max(frames, m_options.captureTicks.back() + 1);
+        }
+    }
+
+    if (!DirectoryExists(m_options.outputDir.c_str())) {
+        MakeDirectory(m_options.outputDir.c_str());
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    SearchAndSetResourceDir("resources");
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(m_options.width, m_options.height, "Journey of the Prairie King (headless)");
+    RenderStats::Install();
+
+    AssetManager assets;
+    assets.LoadAssets();
+    SetTextureFilter(assets.GetTexture(TextureId::Cursors), TEXTURE_FILTER_POINT);
+
+    if (!m_options.check.empty()) {
+        const bool passed = CheckBulletSweep(assets);
+        assets.UnloadAssets();
+        CloseWindow();
+        return passed ? 0 : 1;
+    }
+
+    // The game only draws from std::rand, so the seed makes the whole run repeatable
+    std::srand(replay.GetSeed());
+    auto game = std::make_unique<PrairieKing>(assets);
+    constexpr int TILE = GameConstants::BASE_TILE_SIZE * GameConstants::PIXEL_ZOOM;
+    for (int i = 0; i < m_options.horde; i++) {
+        // Overlaps are the point, so this skips AddMonster's free spot check. std::rand keeps
+        // the layout tied to the seed like everything else
+        const Vector2 tile = { static_cast<float>((1 + std::rand() % (PrairieKing::MAP_WIDTH - 2)) * TILE),
+                               static_cast<float>((1 + std::rand() % (PrairieKing::MAP_HEIGHT - 2)) * TILE) };
+        game->PushMonster(new PrairieKing::CowboyMonster(assets, GameConstants::ORC, tile));
+    }
+    if (m_options.horde > 0) {
+        // Otherwise the first orc to reach the player kills it, which clears the whole crowd
+        game->SetButtonState(PrairieKing::GameKeys::DebugToggle, true);
+        game->SetButtonState(PrairieKing::GameKeys::DebugToggle, false);
+        game->SetButtonState(PrairieKing::GameKeys::DebugGodMode, true);
+        game->SetButtonState(PrairieKing::GameKeys::DebugGodMode, false);
+    }
+    // Recorded and replayed on this thread, one tick at a time, so captures stay exact
+    DrawList list;
+    auto renderer = std::make_unique<DrawListRenderer>();
+
+    bool allMatched = true;
+    size_t nextCapture = 0;
+    m_frames.clear();
+    m_frames.reserve(frames);
+
+    for (int tick = 0; tick < frames; tick++) {
+        replay.Apply(*game, tick);
+
+        double start = GetTime();
+        game->Update(TICK_SECONDS);
+        double updated = GetTime();
+
+        const bool capture = nextCapture < m_options.captureTicks.size() &&
+                             m_options.captureTicks[nextCapture] == tick;
+
+        RenderStats::BeginFrame();
+        double drawStart = GetTime();
+        BeginDrawing();
+        ClearBackground(BLACK);
+        game->Draw(list);
+        renderer->Render(list, assets.GetTexture(TextureId::Cursors));
+
+        Image shot = {};
+        if (capture) {
+            // Read the back buffer before EndDrawing swaps it away
+            rlDrawRenderBatchActive();
+            shot = LoadImageFromScreen();
+        }
+        EndDrawing();
+        double drawEnd = GetTime();
+
+        m_frames.push_back(FrameStats{ tick, (updated - start) * 1000.0, (drawEnd - drawStart) * 1000.0,
+                                       RenderStats::GetDrawCalls() });
+
+        if (capture) {
+            nextCapture++;
+            std::string shotPath = m_options.outputDir + "/" + CaptureName(tick) + ".png";
+            ExportImage(shot, shotPath.c_str());
+            UnloadImage(shot);
+
+            if (!m_options.goldenDir.empty() && !CheckCapture(tick, shotPath)) {
+                allMatched = false;
+            }
+        }
+    }
+
+    renderer.reset();
+    game.reset();
+    assets.UnloadAssets();
+    CloseWindow();
+
+    PrintSummary();
+    if (!m_options.statsPath.empty() && !WriteStats()) {
+        std::printf("headless: can't write %s\n", m_options.statsPath.c_str());
+        return 2;
+    }
+    return allMatched ? 0 : 1;
+}
+
+bool HeadlessRunner::CheckBulletSweep(AssetManager& assets) {
+    constexpr float TILE = GameConstants::BASE_TILE_SIZE * GameConstants::PIXEL_ZOOM;
+    constexpr float BULLET_OFFSET = (TILE - 12.0f) / 2.0f; // Bullets are 12x12, centered in their lane
+    // 1/10 s is a bad frame hitch; at 1/4 s a bullet moves further per
+    // step than a tile, so anything tested only where a step ends would be skipped
+    constexpr float STEPS_PER_SECOND[] = { 60.0f, 10.0f, 4.0f };
+    constexpr int RUNS = sizeof(STEPS_PER_SECOND) / sizeof(STEPS_PER_SECOND[0]);
+
+    // Health left on every monster by spawn order, -1 once it's gone
+    std::vector<int> outcomes[RUNS];
+    for (int run = 0; run < RUNS; run++) {
+        std::srand(1);
+        auto game = std::make_unique<PrairieKing>(assets);
+        int spawned = 0;
+        PrairieKing::CowboyMonster* invisible = nullptr;
+        auto spawn = [&](int type, int column, int row) {
+            game->PushMonster(new PrairieKing::CowboyMonster(assets, type, Vector2{ column * TILE, row * TILE }));
+            spawned++;
+        };
+
+        // Clear lanes through the middle of the map, so only the walls placed here stop bullets
+        for (int row = 3; row <= 11; row++) {
+            for (int column = 1; column < PrairieKing::MAP_WIDTH - 1; column++) {
+                game->SetMapTile(column, row, PrairieKing::MAP_DESERT);
+            }
+        }
+
+        // One bullet into a row of orcs: it's spent on the first
+        spawn(GameConstants::ORC, 6, 3);
+        spawn(GameConstants::ORC, 8, 3);
+        spawn(GameConstants::ORC, 9, 3);
+        game->PushBullet(PrairieKing::CowboyBullet(Vector2{ 2 * TILE, 3 * TILE + BULLET_OFFSET }, 1, 1));
+
+        // One into an ogre, which takes a point of damage and keeps the orc behind it safe
+        spawn(GameConstants::OGRE, 8, 5);
+        spawn(GameConstants::ORC, 10, 5);
+        game->PushBullet(PrairieKing::CowboyBullet(Vector2{ 2 * TILE, 5 * TILE + BULLET_OFFSET }, 1, 1));
+
+        // A one tile fence in front of an orc
+        game->SetMapTile(6, 7, PrairieKing::MAP_FENCE);
+        spawn(GameConstants::ORC, 9, 7);
+        game->PushBullet(PrairieKing::CowboyBullet(Vector2{ 2 * TILE, 7 * TILE + BULLET_OFFSET }, 1, 1));
+
+        // An invisible orc takes no damage, so the bullet goes on to the orc behind it
+        spawn(GameConstants::ORC, 6, 9);
+        spawn(GameConstants::ORC, 9, 9);
+        game->QueryMonstersInRect(Rectangle{ 6 * TILE, 9 * TILE, 1, 1 }, &invisible, 1);
+        invisible->invisible = true;
+        game->PushBullet(PrairieKing::CowboyBullet(Vector2{ 2 * TILE, 9 * TILE + BULLET_OFFSET }, 1, 1));
+
+        // And one shot down a column
+        spawn(GameConstants::ORC, 12, 11);
+        game->PushBullet(PrairieKing::CowboyBullet(Vector2{ 12 * TILE + BULLET_OFFSET, 4 * TILE }, 2, 1));
+
+        // Only the bullets move, so the monsters stand still for every step size
+        const float step = 1.0f / STEPS_PER_SECOND[run];
+        for (int i = 0; i < 2 * static_cast<int>(STEPS_PER_SECOND[run]); i++) {
+            game->UpdateBullets(step);
+        }
+
+        outcomes[run].assign(spawned, -1);
+        PrairieKing::CowboyMonster* left[PrairieKing::MAX_QUERY_RESULTS];
+        const int count = game->QueryMonstersInRect(Rectangle{ 0, 0, PrairieKing::MAP_WIDTH * TILE, PrairieKing::MAP_HEIGHT * TILE },
+                                                    left, PrairieKing::MAX_QUERY_RESULTS);
+        for (int i = 0; i < count; i++) {
+            outcomes[run][left[i]->spawnOrder] = left[i]->health;
+        }
+    }
+
+    // What the setup above expects, in spawn order
+    const std::vector<int> expected = { -1, 1, 1, 2, 1, 1, 1, -1, -1 };
+    bool passed = true;
+    for (int run = 0; run < RUNS; run++) {
+        if (outcomes[run] != expected) {
+            passed = false;
+        }
+    }
+
+    std::printf("headless: bullet sweep at 1/60, 1/10 and 1/4 s steps %s\n", passed ? "hits the same monsters" : "differs");
+    for (size_t i = 0; !passed && i < expected.size(); i++) {
+        std::printf("  monster %zu  expected %d  1/60 %d  1/10 %d  1/4 %d\n", i, expected[i],
+                    outcomes[0][i], outcomes[1][i], outcomes[2][i]);
+    }
+    return passed;
+}
+
+bool HeadlessRunner::CheckCapture(int tick, const std::string& shotPath) const {
+    const std::string name = CaptureName(tick);
+    const std::string goldenPath = m_options.goldenDir + "/" + name + ".png";
+    if (!FileExists(goldenPath.c_str())) {
+        std::printf("headless: %s has no golden image (%s)\n", name.c_str(), goldenPath.c_str());
+        return false;
+    }
+
+    Image golden = LoadImage(goldenPath.c_str());
+    Image shot = LoadImage(shotPath.c_str());
+    ImageFormat(&golden, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    ImageFormat(&shot, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    bool matched = false;
+    if (golden.width != shot.width || golden.height != shot.height) {
+        std::printf("headless: %s is %dx%d, golden is %dx%d\n", name.c_str(),
+                    shot.width, shot.height, golden.width, golden.height);
+    }
+    else {
+        // Differing pixels are painted red over a dimmed copy of the capture
+        Image diff = ImageCopy(shot);
+        const unsigned char* a = static_cast<const unsigned char*>(shot.data);
+        const unsigned char* b = static_cast<const unsigned char*>(golden.data);
+        unsigned char* out = static_cast<unsigned char*>(diff.data);
+        int differing = 0;
+        const int pixels = shot.width * shot.height;
+        for (int i = 0; i < pixels; i++) {
+            bool same = true;
+            for (int c = 0; c < 4; c++) {
+                if (std::abs(a[i * 4 + c] - b[i * 4 + c]) > m_options.tolerance) {
+                    same = false;
+                }
+            }
+            if (same) {
+                for (int c = 0; c < 3; c++) {
+                    out[i * 4 + c] /= 4;
+                }
+            }
+            else {
+                differing++;
+                out[i * 4 + 0] = 255;
+                out[i * 4 + 1] = 0;
+                out[i * 4 + 2] = 0;
+                out[i * 4 + 3] = 255;
+            }
+        }
+
+        matched = differing <= m_options.maxDiffPixels;
+        if (!matched) {
+            std::string diffPath = m_options.outputDir + "/" + name + "_diff.png";
+            ExportImage(diff, diffPath.c_str());
+            std::printf("headless: %s differs from golden in %d pixels (see %s)\n",
+                        name.c_str(), differing, diffPath.c_str());
+        }
+        UnloadImage(diff);
+    }
+
+    UnloadImage(golden);
+    UnloadImage(shot);
+    return matched;
+}
+
+void HeadlessRunner::PrintSummary() const {
+    if (m_frames.empty()) {
+        return;
+    }
+
+    std::vector<double> updateTimes;
+    std::vector<double> drawTimes;
+    double totalDraw = 0.0;
+    double totalUpdate = 0.0;
+    long long totalCalls = 0;
+    int maxCalls = 0;
+    updateTimes.reserve(m_frames.size());
+    drawTimes.reserve(m_frames.size());
+    for (const FrameStats& frame : m_frames) {
+        updateTimes.push_back(frame.updateMs);
+        drawTimes.push_back(frame.drawMs);
+        totalDraw += frame.drawMs;
+        totalUpdate += frame.updateMs;
+        totalCalls += frame.drawCalls;
+        maxCalls = std::max(maxCalls, frame.drawCalls);
+    }
+    const double count = static_cast<double>(m_frames.size());
+
+    std::printf("headless: %zu frames at %dx%d\n", m_frames.size(), m_options.width, m_options.height);
+    std::printf("  update ms  mean %.3f  p50 %.3f  p95 %.3f  max %.3f\n", totalUpdate / count,
+                Percentile(updateTimes, 0.5), Percentile(updateTimes, 0.95), Percentile(updateTimes, 1.0));
+    std::printf("  draw ms    mean %.3f  p50 %.3f  p95 %.3f  max %.3f\n", totalDraw / count,
+                Percentile(drawTimes, 0.5), Percentile(drawTimes, 0.95), Percentile(drawTimes, 1.0));
+    if (RenderStats::IsInstalled()) {
+        std::printf("  draw calls mean %.1f  max %d\n", totalCalls / count, maxCalls);
+    }
+    else {
+        std::printf("  draw calls n/a on this graphics backend\n");
+    }
+}
+
+bool HeadlessRunner::WriteStats() const {
+    std::ofstream file(m_options.statsPath);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << "tick,update_ms,draw_ms,draw_calls\n";
+    for (const FrameStats& frame : m_frames) {
+        file << frame.tick << ',' << frame.updateMs << ',' << frame.drawMs << ',' << frame.drawCalls << '\n';
+    }
+    return true;
+}
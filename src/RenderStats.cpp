@@ -0,0 +1,77 @@
+#include "RenderStats.hpp"
+
+bool RenderStats::s_installed = false;
+int RenderStats::s_drawCalls = -1;
+
+#if defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_43)
+
+// Same calling convention glad uses for the GL entry points
+#if defined(_WIN32) && !defined(__CYGWIN__)
+    #define RENDER_STATS_GL_API __stdcall
+#else
+    #define RENDER_STATS_GL_API
+#endif
+
+using DrawArraysProc = void (RENDER_STATS_GL_API *)(unsigned int mode, int first, int count);
+using DrawElementsProc = void (RENDER_STATS_GL_API *)(unsigned int mode, int count, unsigned int type, const void* indices);
+
+// Function pointers raylib's rlgl loads through glad (raylib is built from source with the game)
+extern "C" DrawArraysProc glad_glDrawArrays;
+extern "C" DrawElementsProc glad_glDrawElements;
+
+namespace {
+    DrawArraysProc s_drawArrays = nullptr;
+    DrawElementsProc s_drawElements = nullptr;
+
+    void RENDER_STATS_GL_API CountedDrawArrays(unsigned int mode, int first, int count) {
+        RenderStats::CountDrawCall();
+        s_drawArrays(mode, first, count);
+    }
+
+    void RENDER_STATS_GL_API CountedDrawElements(unsigned int mode, int count, unsigned int type, const void* indices) {
+        RenderStats::CountDrawCall();
+        s_drawElements(mode, count, type, indices);
+    }
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_43)
+using DrawArraysInstancedProc = void (RENDER_STATS_GL_API *)(unsigned int mode, int first, int count, int instances);
+
+extern "C" DrawArraysInstancedProc glad_glDrawArraysInstanced;
+
+namespace {
+    DrawArraysInstancedProc s_drawArraysInstanced = nullptr;
+
+    void RENDER_STATS_GL_API CountedDrawArraysInstanced(unsigned int mode, int first, int count, int instances) {
+        RenderStats::CountDrawCall();
+        s_drawArraysInstanced(mode, first, count, instances);
+    }
+}
+#endif
+
+void RenderStats::Install() {
+    if (s_installed || glad_glDrawArrays == nullptr || glad_glDrawElements == nullptr) {
+        return;
+    }
+
+    s_drawArrays = glad_glDrawArrays;
+    glad_glDrawArrays = CountedDrawArrays;
+    s_drawElements = glad_glDrawElements;
+    glad_glDrawElements = CountedDrawElements;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_43)
+    if (glad_glDrawArraysInstanced != nullptr) {
+        s_drawArraysInstanced = glad_glDrawArraysInstanced;
+        glad_glDrawArraysInstanced = CountedDrawArraysInstanced;
+    }
+#endif
+
+    s_installed = true;
+    s_drawCalls = 0;
+}
+
+#else
+
+void RenderStats::Install() {}
+
+#endif
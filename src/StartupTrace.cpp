@@ -0,0 +1,26 @@
+#include "StartupTrace.hpp"
+#include <cstdio>
+
+std::chrono::steady_clock::time_point StartupTrace::s_start = std::chrono::steady_clock::now();
+std::vector<StartupTrace::Entry> StartupTrace::s_entries;
+std::mutex StartupTrace::s_mutex;
+
+void StartupTrace::Begin() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_start = std::chrono::steady_clock::now();
+    s_entries.clear();
+}
+
+void StartupTrace::Mark(const char* label) {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_entries.push_back(Entry{ label, std::chrono::duration<double, std::milli>(now - s_start).count() });
+}
+
+void StartupTrace::Print() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    std::printf("startup:\n");
+    for (const Entry& entry : s_entries) {
+        std::printf("  %8.1f ms  %s\n", entry.ms, entry.label.c_str());
+    }
+}
@@ -0,0 +1,137 @@
+#include "TextCache.hpp"
+#include "rlgl.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    // raylib's default gap between lines of DrawTextEx
+    constexpr float LINE_SPACING = 2.0f;
+
+    uint64_t HashRun(const Font& font, const char* text, float fontSize, float spacing) {
+        // FNV-1a over the style and then the text. Every font samples the same atlas, so the
+        // font is identified by its glyph rects, not its texture
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](const void* data, size_t size) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; i++) {
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            }
+        };
+        mix(&font.recs, sizeof(font.recs));
+        mix(&fontSize, sizeof(fontSize));
+        mix(&spacing, sizeof(spacing));
+        mix(text, std::strlen(text));
+        return hash;
+    }
+}
+
+bool TextRun::Matches(const Font& font, float fontSize, float spacing) const {
+    return m_recs == font.recs && m_fontSize == fontSize && m_spacing == spacing;
+}
+
+void TextRun::Set(const Font& font, const char* text, float fontSize, float spacing) {
+    if (!m_hasNumber && Matches(font, fontSize, spacing) && m_text == text) {
+        return;
+    }
+    m_hasNumber = false;
+    Layout(font, text, fontSize, spacing);
+}
+
+void TextRun::SetNumber(const Font& font, const char* prefix, int value, float fontSize, float spacing) {
+    const size_t prefixLength = std::strlen(prefix);
+    if (m_hasNumber && m_number == value && Matches(font, fontSize, spacing) &&
+        m_prefixLength == prefixLength && m_text.compare(0, prefixLength, prefix) == 0) {
+        return;
+    }
+    m_hasNumber = true;
+    m_number = value;
+    m_prefixLength = prefixLength;
+    Layout(font, (std::string(prefix) + std::to_string(value)).c_str(), fontSize, spacing);
+}
+
+// Same placement rules as DrawTextEx, done once and kept
+void TextRun::Layout(const Font& font, const char* text, float fontSize, float spacing) {
+    m_text = text;
+    m_recs = font.recs;
+    m_texture = font.texture;
+    m_fontSize = fontSize;
+    m_spacing = spacing;
+    m_size = MeasureTextEx(font, text, fontSize, spacing);
+    m_glyphs.clear();
+
+    if (font.baseSize == 0 || font.glyphs == nullptr) {
+        return;
+    }
+
+    const float scale = fontSize / static_cast<float>(font.baseSize);
+    const float padding = static_cast<float>(font.glyphPadding);
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
+
+    const int length = static_cast<int>(std::strlen(text));
+    for (int i = 0; i < length;) {
+        int codepointSize = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointSize);
+        int index = GetGlyphIndex(font, codepoint);
+        i += codepointSize;
+
+        if (codepoint == '\n') {
+            offsetY += fontSize + LINE_SPACING;
+            offsetX = 0.0f;
+            continue;
+        }
+
+        const Rectangle& rec = font.recs[index];
+        const GlyphInfo& glyph = font.glyphs[index];
+        if (codepoint != ' ' && codepoint != '\t') {
+            m_glyphs.push_back(Glyph{
+                Rectangle{rec.x - padding, rec.y - padding, rec.width + 2.0f * padding, rec.height + 2.0f * padding},
+                Rectangle{offsetX + (glyph.offsetX - padding) * scale,
+                          offsetY + (glyph.offsetY - padding) * scale,
+                          (rec.width + 2.0f * padding) * scale,
+                          (rec.height + 2.0f * padding) * scale}});
+        }
+
+        offsetX += (glyph.advanceX == 0 ? rec.width : static_cast<float>(glyph.advanceX)) * scale + spacing;
+    }
+}
+
+void TextRun::Draw(Vector2 position, Color tint) const {
+    if (m_glyphs.empty()) {
+        return;
+    }
+
+    const float width = static_cast<float>(m_texture.width);
+    const float height = static_cast<float>(m_texture.height);
+
+    rlSetTexture(m_texture.id);
+    for (const Glyph& glyph : m_glyphs) {
+        const Rectangle& src = glyph.source;
+        const float left = position.x + glyph.dest.x;
+        const float top = position.y + glyph.dest.y;
+        const float right = left + glyph.dest.width;
+        const float bottom = top + glyph.dest.height;
+
+        rlCheckRenderBatchLimit(4);
+        rlBegin(RL_QUADS);
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+        rlTexCoord2f(src.x / width, src.y / height);
+        rlVertex2f(left, top);
+        rlTexCoord2f(src.x / width, (src.y + src.height) / height);
+        rlVertex2f(left, bottom);
+        rlTexCoord2f((src.x + src.width) / width, (src.y + src.height) / height);
+        rlVertex2f(right, bottom);
+        rlTexCoord2f((src.x + src.width) / width, src.y / height);
+        rlVertex2f(right, top);
+        rlEnd();
+    }
+    rlSetTexture(0);
+}
+
+const TextRun& TextCache::Get(const Font& font, const char* text, float fontSize, float spacing) {
+    // A hash collision just lays the run out again for the new text
+    TextRun& run = m_runs[HashRun(font, text, fontSize, spacing)];
+    run.Set(font, text, fontSize, spacing);
+    return run;
+}
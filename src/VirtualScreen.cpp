@@ -0,0 +1,64 @@
+#include "VirtualScreen.hpp"
+#include <algorithm>
+
+VirtualScreen::~VirtualScreen() {
+    if (m_loaded) {
+        UnloadRenderTexture(m_target);
+    }
+}
+
+int VirtualScreen::GetScale() {
+    return GetScale(GetScreenWidth(), GetScreenHeight());
+}
+
+Rectangle VirtualScreen::GetViewport() {
+    return GetViewport(GetScreenWidth(), GetScreenHeight());
+}
+
+int VirtualScreen::GetScale(int screenWidth, int screenHeight) {
+    int scaleX = screenWidth / (WIDTH + 2 * BORDER);
+    int scaleY = screenHeight / (HEIGHT + 2 * BORDER);
+    return std::max(1, std::min(scaleX, scaleY));
+}
+
+Rectangle VirtualScreen::GetViewport(int screenWidth, int screenHeight) {
+    const int scale = GetScale(screenWidth, screenHeight);
+    const int width = WIDTH * scale;
+    const int height = HEIGHT * scale;
+    return Rectangle{
+        static_cast<float>((screenWidth - width) / 2),
+        static_cast<float>((screenHeight - height) / 2),
+        static_cast<float>(width),
+        static_cast<float>(height)};
+}
+
+void VirtualScreen::Load() {
+    m_target = LoadRenderTexture(WIDTH, HEIGHT);
+    SetTextureFilter(m_target.texture, TEXTURE_FILTER_POINT);
+    m_loaded = true;
+}
+
+void VirtualScreen::Begin(const Camera2D& camera) {
+    if (!m_loaded) {
+        Load();
+    }
+    BeginTextureMode(m_target);
+    ClearBackground(BLACK);
+    BeginMode2D(camera);
+}
+
+void VirtualScreen::End() {
+    EndMode2D();
+    EndTextureMode();
+}
+
+void VirtualScreen::Draw() const {
+    if (!m_loaded) {
+        return;
+    }
+
+    // Render textures are stored upside down, hence the negative source height
+    DrawTexturePro(m_target.texture,
+                   Rectangle{0.0f, 0.0f, static_cast<float>(WIDTH), -static_cast<float>(HEIGHT)},
+                   GetViewport(), Vector2{0.0f, 0.0f}, 0.0f, WHITE);
+}
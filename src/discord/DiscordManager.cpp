@@ -4,6 +4,7 @@
 
 std::unique_ptr<discord::Core> DiscordManager::s_core;
 std::int64_t DiscordManager::s_startTime = 0;
+std::mutex DiscordManager::s_mutex;
 
 bool DiscordManager::Initialize() {
     discord::ClientId clientId = 1342619188707197019;
@@ -30,12 +31,14 @@ bool DiscordManager::Initialize() {
 }
 
 void DiscordManager::Update() {
+    std::lock_guard<std::mutex> lock(s_mutex);
     if (s_core) {
         s_core->RunCallbacks();
     }
 }
 
 void DiscordManager::UpdatePresence(const char* state, const char* details) {
+    std::lock_guard<std::mutex> lock(s_mutex);
     if (!s_core) return;
     
     discord::Activity activity{};
@@ -50,5 +53,6 @@ void DiscordManager::UpdatePresence(const char* state, const char* details) {
 }
 
 void DiscordManager::Shutdown() {
+    std::lock_guard<std::mutex> lock(s_mutex);
     s_core.reset();
 }
\ No newline at end of file
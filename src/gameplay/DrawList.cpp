@@ -0,0 +1,151 @@
+#include "gameplay/DrawList.hpp"
+#include "generated/AtlasLayout.hpp"
+#include <cstring>
+
+void DrawList::Reset()
+{
+    m_commands.clear();
+    m_sprites.clear();
+    m_quads.clear();
+    m_instances.clear();
+}
+
+DrawList::Command &DrawList::Push(CommandType type)
+{
+    m_commands.push_back(Command{});
+    Command &command = m_commands.back();
+    command.type = type;
+    return command;
+}
+
+DrawList::Command *DrawList::OpenRange(CommandType type)
+{
+    if (!m_commands.empty() && m_commands.back().type == type)
+    {
+        return &m_commands.back();
+    }
+    return nullptr;
+}
+
+void DrawList::BeginPass(Pass pass, const Camera2D &camera)
+{
+    Command &command = Push(CommandType::BeginPass);
+    command.pass = pass;
+    command.camera = camera;
+}
+
+void DrawList::Clear(Color color)
+{
+    Push(CommandType::Clear).color = color;
+}
+
+void DrawList::SetTileLayer(TileLayer layer, const int (&tiles)[MAP_SIZE][MAP_SIZE], int world, unsigned int revision)
+{
+    TileLayerState &state = m_tileLayers[layer];
+    if (state.world == world && state.revision == revision)
+    {
+        return;
+    }
+    std::memcpy(state.tiles, tiles, sizeof(state.tiles));
+    state.world = world;
+    state.revision = revision;
+}
+
+void DrawList::AddTileLayer(TileLayer layer, Vector2 position, float scale, int frame)
+{
+    Command &command = Push(CommandType::TileLayer);
+    command.layer = layer;
+    command.position = position;
+    command.value = scale;
+    command.frame = frame;
+}
+
+void DrawList::AddSprite(const Rectangle &source, const Rectangle &dest, float depth,
+                         Color tint, float rotation, bool flipX)
+{
+    Command *range = OpenRange(CommandType::Sprites);
+    if (range == nullptr)
+    {
+        range = &Push(CommandType::Sprites);
+        range->first = static_cast<uint32_t>(m_sprites.size());
+    }
+    m_sprites.push_back(Sprite{source, dest, tint, rotation, depth, flipX});
+    range->count++;
+}
+
+void DrawList::ClearSprites()
+{
+    Push(CommandType::ClearSprites);
+}
+
+void DrawList::FlushSprites(float maxDepth)
+{
+    Push(CommandType::FlushSprites).value = maxDepth;
+}
+
+void DrawList::AddQuad(const Rectangle &source, const Rectangle &dest, Color tint)
+{
+    Command *range = OpenRange(CommandType::Quads);
+    if (range == nullptr)
+    {
+        range = &Push(CommandType::Quads);
+        range->first = static_cast<uint32_t>(m_quads.size());
+    }
+    m_quads.push_back(Quad{source, dest, tint});
+    range->count++;
+}
+
+void DrawList::AddRectangle(float x, float y, float width, float height, Color color)
+{
+    AddQuad(AtlasLayout::WHITE_TEXEL, Rectangle{x, y, width, height}, color);
+}
+
+void DrawList::AddRectangle(const Rectangle &rect, Color color)
+{
+    AddQuad(AtlasLayout::WHITE_TEXEL, rect, color);
+}
+
+// Same four bars DrawRectangleLinesEx draws
+void DrawList::AddRectangleLines(const Rectangle &rect, float thickness, Color color)
+{
+    AddRectangle(rect.x, rect.y, rect.width, thickness, color);
+    AddRectangle(rect.x, rect.y + rect.height - thickness, rect.width, thickness, color);
+    AddRectangle(rect.x, rect.y + thickness, thickness, rect.height - thickness * 2.0f, color);
+    AddRectangle(rect.x + rect.width - thickness, rect.y + thickness, thickness, rect.height - thickness * 2.0f, color);
+}
+
+void DrawList::AddText(const TextRun &run, Vector2 position, Color tint)
+{
+    for (const TextRun::Glyph &glyph : run.GetGlyphs())
+    {
+        AddQuad(glyph.source,
+                Rectangle{position.x + glyph.dest.x, position.y + glyph.dest.y, glyph.dest.width, glyph.dest.height},
+                tint);
+    }
+}
+
+void DrawList::AddText(const Font &font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    m_scratchText.Set(font, text, fontSize, spacing);
+    AddText(m_scratchText, position, tint);
+}
+
+void DrawList::BeginInstances(const Rectangle &source, Vector2 size, Color tint)
+{
+    Command &command = Push(CommandType::Instances);
+    command.source = source;
+    command.position = size;
+    command.color = tint;
+    command.first = static_cast<uint32_t>(m_instances.size());
+}
+
+void DrawList::AddInstance(Vector2 position, int frame)
+{
+    Command *group = OpenRange(CommandType::Instances);
+    if (group == nullptr)
+    {
+        return;
+    }
+    m_instances.push_back(Instance{position, frame});
+    group->count++;
+}
@@ -0,0 +1,135 @@
+#include "gameplay/DrawListRenderer.hpp"
+#include "gameplay/PrairieKing.hpp"
+
+static_assert(DrawList::MAP_SIZE == TileLayerCache::SIZE, "Tile layer snapshots must match the cache size");
+static_assert(DrawList::MAP_SIZE == PrairieKing::MAP_WIDTH && DrawList::MAP_SIZE == PrairieKing::MAP_HEIGHT,
+              "Tile layer snapshots must match the map size");
+
+void DrawListRenderer::RefreshTileLayer(const DrawList &list, DrawList::TileLayer layer, const Texture2D &atlas)
+{
+    const DrawList::TileLayerState &state = list.GetTileLayer(layer);
+    if (state.revision != m_tileRevisions[layer])
+    {
+        m_tileLayers[layer].Invalidate();
+        m_tileRevisions[layer] = state.revision;
+    }
+
+    const int world = state.world;
+    m_tileLayers[layer].Refresh(atlas, state.tiles, world, [world](int tileType, int frame)
+                                { return PrairieKing::GetTileSourceRect(tileType, world, frame); });
+}
+
+void DrawListRenderer::EndPass()
+{
+    if (!m_inPass)
+    {
+        return;
+    }
+
+    switch (m_pass)
+    {
+    case DrawList::Pass::World:
+        m_virtualScreen.End();
+        m_virtualScreen.Draw();
+        break;
+    case DrawList::Pass::Hud:
+        EndMode2D();
+        break;
+    case DrawList::Pass::Screen:
+        break;
+    }
+    m_inPass = false;
+}
+
+void DrawListRenderer::Render(const DrawList &list, const Texture2D &atlas)
+{
+    const std::vector<DrawList::Command> &commands = list.GetCommands();
+
+    // Render targets don't nest, so layers are brought up to date before any pass starts.
+    // Only layers the list actually draws are refreshed (the next map only while scrolling)
+    for (const DrawList::Command &command : commands)
+    {
+        if (command.type == DrawList::CommandType::TileLayer)
+        {
+            RefreshTileLayer(list, static_cast<DrawList::TileLayer>(command.layer), atlas);
+        }
+    }
+
+    const std::vector<DrawList::Sprite> &sprites = list.GetSprites();
+    const std::vector<DrawList::Quad> &quads = list.GetQuads();
+    const std::vector<DrawList::Instance> &instances = list.GetInstances();
+    m_spriteBatch.Clear();
+
+    for (const DrawList::Command &command : commands)
+    {
+        switch (command.type)
+        {
+        case DrawList::CommandType::BeginPass:
+            EndPass();
+            m_pass = command.pass;
+            m_inPass = true;
+            if (m_pass == DrawList::Pass::World)
+            {
+                m_virtualScreen.Begin(command.camera);
+            }
+            else if (m_pass == DrawList::Pass::Hud)
+            {
+                BeginMode2D(command.camera);
+            }
+            break;
+
+        case DrawList::CommandType::Clear:
+            ClearBackground(command.color);
+            break;
+
+        case DrawList::CommandType::TileLayer:
+            m_tileLayers[command.layer].Draw(command.position, command.value, command.frame);
+            break;
+
+        case DrawList::CommandType::Sprites:
+            for (uint32_t i = command.first; i < command.first + command.count; i++)
+            {
+                const DrawList::Sprite &sprite = sprites[i];
+                m_spriteBatch.Add(sprite.source, sprite.dest, sprite.depth, sprite.tint, sprite.rotation, sprite.flipX);
+            }
+            break;
+
+        case DrawList::CommandType::ClearSprites:
+            m_spriteBatch.Clear();
+            break;
+
+        case DrawList::CommandType::FlushSprites:
+            if (std::isinf(command.value))
+            {
+                m_spriteBatch.Flush(atlas);
+            }
+            else
+            {
+                m_spriteBatch.FlushBelow(atlas, command.value);
+            }
+            break;
+
+        case DrawList::CommandType::Quads:
+            for (uint32_t i = command.first; i < command.first + command.count; i++)
+            {
+                const DrawList::Quad &quad = quads[i];
+                DrawTexturePro(atlas, quad.source, quad.dest, Vector2{0.0f, 0.0f}, 0.0f, quad.tint);
+            }
+            break;
+
+        case DrawList::CommandType::Instances:
+            if (command.count == 0)
+            {
+                break;
+            }
+            for (uint32_t i = command.first; i < command.first + command.count; i++)
+            {
+                m_instancer.Add(instances[i].position, instances[i].frame);
+            }
+            m_instancer.Draw(atlas, command.source, command.position, command.color);
+            break;
+        }
+    }
+
+    EndPass();
+}
@@ -0,0 +1,231 @@
+#include "gameplay/FlowField.hpp"
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+FlowField::FlowField()
+    : m_goalX(-1), m_goalY(-1)
+{
+    for (int x = 0; x < SIZE; x++)
+    {
+        for (int y = 0; y < SIZE; y++)
+        {
+            m_distance[x][y] = UNREACHABLE;
+        }
+    }
+}
+
+void FlowField::Rebuild(const TileMask &blocked, int goalX, int goalY)
+{
+    m_blocked = blocked;
+    m_goalX = goalX;
+    m_goalY = goalY;
+
+    for (int x = 0; x < SIZE; x++)
+    {
+        for (int y = 0; y < SIZE; y++)
+        {
+            m_distance[x][y] = UNREACHABLE;
+        }
+    }
+
+    if (!TileMask::InBounds(goalX, goalY))
+    {
+        return;
+    }
+
+    // Plain BFS, every step costs one tile. The goal is seeded even if it is blocked
+    // so monsters still home in on a player standing on a bridge edge or similar
+    int queue[SIZE * SIZE];
+    int head = 0;
+    int tail = 0;
+
+    m_distance[goalX][goalY] = 0;
+    queue[tail++] = goalY * SIZE + goalX;
+
+    while (head < tail)
+    {
+        int x = queue[head] % SIZE;
+        int y = queue[head] / SIZE;
+        head++;
+
+        for (int direction = UP; direction <= LEFT; direction++)
+        {
+            int nx = x + StepX(direction);
+            int ny = y + StepY(direction);
+            if (!TileMask::InBounds(nx, ny) || m_blocked.Test(nx, ny) || m_distance[nx][ny] != UNREACHABLE)
+            {
+                continue;
+            }
+
+            m_distance[nx][ny] = static_cast<uint16_t>(m_distance[x][y] + 1);
+            queue[tail++] = ny * SIZE + nx;
+        }
+    }
+}
+
+void FlowField::Repair(const TileMask &blocked, const TileMask &dirty)
+{
+    if (!TileMask::InBounds(m_goalX, m_goalY))
+    {
+        Rebuild(blocked, m_goalX, m_goalY);
+        return;
+    }
+
+    // Only tiles whose passability actually flipped matter; the goal keeps distance 0 either way
+    TileMask opened = dirty & m_blocked & ~blocked;
+    TileMask closed = dirty & ~m_blocked & blocked;
+    opened.Reset(m_goalX, m_goalY);
+    closed.Reset(m_goalX, m_goalY);
+    m_blocked = blocked;
+    if (!opened.Any() && !closed.Any())
+    {
+        return;
+    }
+
+    using Entry = std::pair<uint16_t, int>; // (distance, y * SIZE + x)
+    using MinQueue = std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>>;
+
+    // Increase-key: walk outward from the closed tiles in order of their old distance and
+    // collect every tile left without a parent one step closer to the goal. Visiting in
+    // distance order guarantees a tile's possible parents were classified before it
+    TileMask affected = closed;
+    MinQueue pending;
+    closed.ForEach([&](int x, int y)
+                   { pending.push({m_distance[x][y], y * SIZE + x}); });
+
+    while (!pending.empty())
+    {
+        int x = pending.top().second % SIZE;
+        int y = pending.top().second / SIZE;
+        pending.pop();
+        if (m_distance[x][y] == UNREACHABLE)
+        {
+            continue;
+        }
+
+        for (int direction = UP; direction <= LEFT; direction++)
+        {
+            int nx = x + StepX(direction);
+            int ny = y + StepY(direction);
+            if (!TileMask::InBounds(nx, ny) || m_blocked.Test(nx, ny) || affected.Test(nx, ny) ||
+                m_distance[nx][ny] != m_distance[x][y] + 1)
+            {
+                continue;
+            }
+
+            bool supported = false;
+            for (int side = UP; side <= LEFT && !supported; side++)
+            {
+                int sx = nx + StepX(side);
+                int sy = ny + StepY(side);
+                supported = TileMask::InBounds(sx, sy) && !affected.Test(sx, sy) &&
+                            (!m_blocked.Test(sx, sy) || (sx == m_goalX && sy == m_goalY)) &&
+                            m_distance[sx][sy] == m_distance[x][y];
+            }
+
+            if (!supported)
+            {
+                affected.Set(nx, ny);
+                pending.push({m_distance[nx][ny], ny * SIZE + nx});
+            }
+        }
+    }
+
+    affected.ForEach([this](int x, int y)
+                     { m_distance[x][y] = UNREACHABLE; });
+
+    // Decrease-key: seed every invalidated or newly opened tile from its best settled
+    // neighbour, then relax outward like Dijkstra with unit costs
+    MinQueue frontier;
+    auto seed = [&](int x, int y)
+    {
+        if (m_blocked.Test(x, y))
+        {
+            return;
+        }
+        uint16_t distance = LowestNeighbourDistance(x, y);
+        if (distance != UNREACHABLE)
+        {
+            m_distance[x][y] = static_cast<uint16_t>(distance + 1);
+            frontier.push({m_distance[x][y], y * SIZE + x});
+        }
+    };
+    (affected | opened).ForEach(seed);
+
+    while (!frontier.empty())
+    {
+        uint16_t distance = frontier.top().first;
+        int x = frontier.top().second % SIZE;
+        int y = frontier.top().second / SIZE;
+        frontier.pop();
+        if (distance != m_distance[x][y])
+        {
+            continue; // Stale entry, a shorter route was found meanwhile
+        }
+
+        for (int direction = UP; direction <= LEFT; direction++)
+        {
+            int nx = x + StepX(direction);
+            int ny = y + StepY(direction);
+            if (!TileMask::InBounds(nx, ny) || m_blocked.Test(nx, ny) || m_distance[nx][ny] <= distance + 1)
+            {
+                continue;
+            }
+
+            m_distance[nx][ny] = static_cast<uint16_t>(distance + 1);
+            frontier.push({m_distance[nx][ny], ny * SIZE + nx});
+        }
+    }
+}
+
+uint16_t FlowField::LowestNeighbourDistance(int x, int y) const
+{
+    uint16_t lowest = UNREACHABLE;
+    for (int direction = UP; direction <= LEFT; direction++)
+    {
+        uint16_t distance = GetDistance(x + StepX(direction), y + StepY(direction));
+        if (distance < lowest)
+        {
+            lowest = distance;
+        }
+    }
+    return lowest;
+}
+
+uint16_t FlowField::GetDistance(int x, int y) const
+{
+    if (!TileMask::InBounds(x, y))
+    {
+        return UNREACHABLE;
+    }
+    return m_distance[x][y];
+}
+
+int FlowField::GetDirection(int x, int y) const
+{
+    uint16_t best = GetDistance(x, y);
+    if (best == 0)
+    {
+        return NO_DIRECTION;
+    }
+
+    // On ties prefer the axis with more ground left to cover, which keeps paths diagonal-ish
+    bool preferHorizontal = std::abs(m_goalX - x) >= std::abs(m_goalY - y);
+    const int order[4] = {preferHorizontal ? RIGHT : DOWN, preferHorizontal ? LEFT : UP,
+                          preferHorizontal ? DOWN : RIGHT, preferHorizontal ? UP : LEFT};
+
+    int bestDirection = NO_DIRECTION;
+    for (int direction : order)
+    {
+        uint16_t distance = GetDistance(x + StepX(direction), y + StepY(direction));
+        if (distance < best)
+        {
+            best = distance;
+            bestDirection = direction;
+        }
+    }
+    return bestDirection;
+}
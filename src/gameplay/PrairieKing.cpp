@@ -1,10 +1,12 @@
 #include "gameplay/PrairieKing.hpp"
 #include "discord/DiscordManager.hpp"
+#include "VirtualScreen.hpp"
 #include <cstdlib>
 #include <iostream>
 #include <ctime>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 // Static game instance pointer for accessing from static methods
 static PrairieKing *s_instance = nullptr;
@@ -15,18 +17,15 @@ PrairieKing::CowboyPowerup::CowboyPowerup(int which, Vector2 position, int durat
 {
 }
 
-void PrairieKing::CowboyPowerup::Draw(const Texture2D &cursorTexture, Vector2 topLeftScreenCoordinate) const
+void PrairieKing::CowboyPowerup::Draw(DrawList &list, Vector2 topLeftScreenCoordinate) const
 {
     if (duration > 2000 || duration / 200 % 2 == 0)
     {
         Rectangle source = {144.0f + which * 16.0f, 160.0f, 16.0f, 16.0f};
-        DrawTexturePro(
-            cursorTexture,
+        list.AddSprite(
             source,
             Rectangle{topLeftScreenCoordinate.x + position.x, topLeftScreenCoordinate.y + position.y + yOffset, 16.0f * 3, 16.0f * 3},
-            Vector2{0, 0},
-            0.0f,
-            WHITE);
+            GetCharacterDepth(position.y));
     }
 }
 
@@ -102,7 +101,7 @@ bool PrairieKing::TemporaryAnimatedSprite::Update(float deltaTime)
     return false;
 }
 
-void PrairieKing::TemporaryAnimatedSprite::Draw(const Texture2D &texture)
+void PrairieKing::TemporaryAnimatedSprite::Draw(DrawList &list) const
 {
     if (delayBeforeAnimationStart > 0)
         return;
@@ -110,13 +109,13 @@ void PrairieKing::TemporaryAnimatedSprite::Draw(const Texture2D &texture)
     Rectangle source = sourceRect;
     source.x += source.width * currentFrame;
 
-    DrawTexturePro(
-        texture,
+    list.AddSprite(
         source,
         Rectangle{position.x, position.y, source.width * scale, source.height * scale},
-        Vector2{0, 0},
+        layerDepth,
+        tint,
         rotation,
-        tint);
+        flipped);
 }
 
 // Main PrairieKing class implementation
@@ -171,6 +170,7 @@ PrairieKing::PrairieKing(AssetManager &assets)
       m_deathTimer(0),
       m_waveTimer(WAVE_DURATION),
       m_betweenWaveTimer(BETWEEN_WAVE_DURATION),
+      m_monsterGrid(MAP_WIDTH, MAP_HEIGHT, static_cast<float>(BASE_TILE_SIZE * PIXEL_ZOOM)),
       m_heldItem(nullptr),
       m_cactusDanceTimer(0),
       m_playerMotionAnimationTimer(0),
@@ -185,6 +185,10 @@ PrairieKing::PrairieKing(AssetManager &assets)
     // Store the instance pointer for static access
     s_instance = this;
 
+    // Kept current by ApplyInput afterwards; the simulation never asks the window itself
+    m_screenWidth = GetScreenWidth();
+    m_screenHeight = GetScreenHeight();
+
     // Initialize the game
     Initialize();
 }
@@ -206,10 +210,9 @@ void PrairieKing::Initialize()
     m_spreadPistol = false;
     m_waveCompleted = false;
 
-    // Center the screen
-    m_topLeftScreenCoordinate = Vector2{
-        static_cast<float>(GetScreenWidth()) / 2.0f - 384.0f,
-        static_cast<float>(GetScreenHeight()) / 2.0f - 384.0f};
+    // The arena sits where the virtual screen is presented
+    Rectangle viewport = VirtualScreen::GetViewport(m_screenWidth, m_screenHeight);
+    m_topLeftScreenCoordinate = Vector2{viewport.x, viewport.y};
 
     // Initialize monster chances
     m_monsterChances.clear();
@@ -230,8 +233,9 @@ void PrairieKing::Initialize()
     m_endingSong.looping = false;
 
     // Initialize map
-    GetMap(0, m_map);
+    LoadMap(0);
     memcpy(m_nextMap, m_map, sizeof(m_map));
+    m_nextMapRevision++;
 
     // Initialize player position
     m_playerPosition = Vector2{static_cast<float>(8 * GetTileSize()), static_cast<float>(8 * GetTileSize())};
@@ -249,13 +253,14 @@ void PrairieKing::Initialize()
 
     // Clear collections
     m_monsters.clear();
+    m_monsterGrid.Clear();
     m_bullets.clear();
-    m_enemyBullets.clear();
+    m_enemyBullets.Clear();
     m_powerups.clear();
     m_temporarySprites.clear();
     m_playerMovementDirections.clear();
     m_playerShootingDirections.clear();
-    m_storeItems.clear();
+    ClearStoreItems();
     m_activePowerups.clear();
     m_spawnQueue.clear();
     m_spawnQueue.resize(8);
@@ -296,7 +301,7 @@ void PrairieKing::Reset()
     m_spreadPistol = false;
 
     // Reiniciar el mapa
-    GetMap(m_whichWave, m_map);
+    LoadMap(m_whichWave);
 
     // Reiniciar la posición del jugador
     m_playerPosition = {384.0f, 384.0f};
@@ -337,7 +342,7 @@ void PrairieKing::ApplyLevelSpecificStates()
     {
         m_shootoutLevel = true;
         // Create Dracula boss
-        m_monsters.push_back(new Dracula(m_assets));
+        PushMonster(new Dracula(m_assets));
         if (m_whichRound > 0)
         {
             m_monsters.back()->health *= 2;
@@ -365,7 +370,7 @@ void PrairieKing::ApplyLevelSpecificStates()
         // Create Outlaw boss
         Vector2 outlawPos = {static_cast<float>(8 * GetTileSize()), static_cast<float>(13 * GetTileSize())};
         int outlawHealth = (m_world == 0) ? 50 : 100;
-        m_monsters.push_back(new Outlaw(m_assets, outlawPos, outlawHealth));
+        PushMonster(new Outlaw(m_assets, outlawPos, outlawHealth));
 
         // Stop overworld music and play outlaw music
         if (IsMusicStreamPlaying(m_overworldSong))
@@ -416,24 +421,24 @@ bool PrairieKing::GetPowerUp(CowboyPowerup c)
 
     case COIN1:
         m_coins++;
-        PlaySound(GetSound("pickup_coin"));
+        PlaySound(GetSound(SoundId::PickupCoin));
         break;
 
     case COIN5:
         m_coins += 5;
-        PlaySound(GetSound("pickup_coin"));
+        PlaySound(GetSound(SoundId::PickupCoin));
         break;
 
     case POWERUP_LIFE:
         m_lives++;
-        PlaySound(GetSound("cowboy_powerup"));
+        PlaySound(GetSound(SoundId::CowboyPowerup));
         break;
 
     default:
         if (!m_heldItem)
         {
             m_heldItem = std::make_unique<CowboyPowerup>(c);
-            PlaySound(GetSound("cowboy_powerup"));
+            PlaySound(GetSound(SoundId::CowboyPowerup));
             break;
         }
 
@@ -443,7 +448,7 @@ bool PrairieKing::GetPowerUp(CowboyPowerup c)
         m_noPickUpBox = {c.position.x, c.position.y, static_cast<float>(GetTileSize()), static_cast<float>(GetTileSize())};
         tmp->position = c.position;
         m_powerups.push_back(*tmp);
-        PlaySound(GetSound("cowboy_powerup"));
+        PlaySound(GetSound(SoundId::CowboyPowerup));
         return true;
     }
     return true;
@@ -463,7 +468,7 @@ void PrairieKing::UsePowerup(int which)
     case POWERUP_HEART:
         m_itemToHold = 13;
         m_holdItemTimer = 4000;
-        PlaySound(GetSound("cowboy_secret"));
+        PlaySound(GetSound(SoundId::CowboySecret));
 
         // Trigger end cutscene
         m_endCutscene = true;
@@ -497,18 +502,19 @@ void PrairieKing::UsePowerup(int which)
             delete monster;
         }
         m_monsters.clear();
+        m_monsterGrid.Clear();
         m_bullets.clear();
-        m_enemyBullets.clear();
+        m_enemyBullets.Clear();
 
         // Set final map
-        GetMap(-1, m_map); // Special end cutscene map
+        LoadMap(-1); // Special end cutscene map
         m_world = 0;
         break;
 
     case POWERUP_SKULL:
         m_itemToHold = 11;
         m_holdItemTimer = 2000;
-        PlaySound(GetSound("cowboy_secret"));
+        PlaySound(GetSound(SoundId::CowboySecret));
         m_gopherTrain = true;
         m_gopherTrainPosition = -GetTileSize() * 2;
         break;
@@ -516,7 +522,7 @@ void PrairieKing::UsePowerup(int which)
     case POWERUP_LOG:
         m_itemToHold = 12;
         m_holdItemTimer = 2000;
-        PlaySound(GetSound("cowboy_secret"));
+        PlaySound(GetSound(SoundId::CowboySecret));
         m_gopherTrain = true;
         m_gopherTrainPosition = -GetTileSize() * 2;
         break;
@@ -557,7 +563,7 @@ void PrairieKing::UsePowerup(int which)
         m_motionPause = 1800.0f;      // 1.8 seconds for transformation animation
         m_zombieModeTimer = 10000.0f; // 10 seconds active mode (separate from motion pause)
 
-        PlaySound(GetSound("cowboy_powerup"));
+        PlaySound(GetSound(SoundId::CowboyPowerup));
         break;
 
     case POWERUP_TELEPORT:
@@ -621,19 +627,19 @@ void PrairieKing::UsePowerup(int which)
             m_playerPosition = teleportSpot;
             m_monsterConfusionTimer = 2000; // Reduced from 4000 to 2000
             m_playerInvincibleTimer = 2000; // Reduced from 4000 to 2000
-            PlaySound(GetSound("cowboy_powerup"));
+            PlaySound(GetSound(SoundId::CowboyPowerup));
         }
         break;
     }
 
     case POWERUP_LIFE:
         m_lives++;
-        PlaySound(GetSound("cowboy_powerup"));
+        PlaySound(GetSound(SoundId::CowboyPowerup));
         break;
 
     case POWERUP_NUKE:
     {
-        PlaySound(GetSound("cowboy_explosion"));
+        PlaySound(GetSound(SoundId::CowboyExplosion));
 
         if (!m_shootoutLevel)
         {
@@ -644,6 +650,7 @@ void PrairieKing::UsePowerup(int which)
                 delete monster;
             }
             m_monsters.clear();
+            m_monsterGrid.Clear();
         }
         else
         {
@@ -665,23 +672,23 @@ void PrairieKing::UsePowerup(int which)
     case POWERUP_SHOTGUN:
     case POWERUP_SPEED:
         m_shotTimer = 0;
-        PlaySound(GetSound("cowboy_gunload"));
+        PlaySound(GetSound(SoundId::CowboyGunload));
         m_activePowerups[which] = POWERUP_DURATION;
         break;
 
     case COIN1:
         m_coins++;
-        PlaySound(GetSound("pickup_coin"));
+        PlaySound(GetSound(SoundId::PickupCoin));
         break;
 
     case COIN5:
         m_coins += 5;
-        PlaySound(GetSound("pickup_coin"));
+        PlaySound(GetSound(SoundId::PickupCoin));
         break;
 
     default:
         m_activePowerups[which] = POWERUP_DURATION;
-        PlaySound(GetSound("cowboy_powerup"));
+        PlaySound(GetSound(SoundId::CowboyPowerup));
         break;
     }
 
@@ -759,7 +766,7 @@ void PrairieKing::AddGuts(Vector2 position, int whichGuts)
 
 void PrairieKing::EndOfGopherAnimationBehavior2(int extraInfo)
 {
-    PlaySound(GetSound("cowboy_gopher"));
+    PlaySound(GetSound(SoundId::CowboyGopher));
 
     if (fabsf(m_gopherBox.x - 8 * GetTileSize()) > fabsf(m_gopherBox.y - 8 * GetTileSize()))
     {
@@ -799,7 +806,7 @@ void PrairieKing::EndOfGopherAnimationBehavior(int extraInfo)
 
     m_temporarySprites.back().endFunction = [this](int extraInfo)
     { EndOfGopherAnimationBehavior2(extraInfo); };
-    PlaySound(GetSound("cowboy_gopher"));
+    PlaySound(GetSound(SoundId::CowboyGopher));
 }
 
 void PrairieKing::KillOutlaw()
@@ -809,7 +816,7 @@ void PrairieKing::KillOutlaw()
         // Drop POWERUP_LOG in first level (world 0), POWERUP_SKULL in second level (world 1)
         int powerupType = (s_instance->m_world == DESERT_WORLD) ? POWERUP_LOG : POWERUP_SKULL;
         Vector2 powerupPos = {8.0f * s_instance->GetTileSize(), 10.0f * s_instance->GetTileSize()};
-        s_instance->m_powerups.push_back(CowboyPowerup(powerupType, powerupPos, 9999999));
+        s_instance->AddPowerup(CowboyPowerup(powerupType, powerupPos, 9999999));
 
         if (IsMusicStreamPlaying(s_instance->m_outlawSong))
         {
@@ -817,10 +824,10 @@ void PrairieKing::KillOutlaw()
         }
 
         // Set bridge tile to allow passage - THIS IS IMPORTANT
-        s_instance->m_map[8][8] = MAP_BRIDGE;
+        s_instance->SetMapTile(8, 8, MAP_BRIDGE);
         s_instance->m_screenFlash = 200;
 
-        PlaySound(s_instance->GetSound("outlaw_dead"));
+        PlaySound(s_instance->GetSound(SoundId::OutlawDead));
 
         // Add explosion effects
         for (int i = 0; i < 15; i++)
@@ -844,240 +851,313 @@ void PrairieKing::KillOutlaw()
             delete monster;
         }
         s_instance->m_monsters.clear();
+        s_instance->m_monsterGrid.Clear();
     }
 }
 
-void PrairieKing::UpdateBullets(float deltaTime)
+// Entry time (0..1) of a point moving from -> to into rect, touching edges don't count
+static bool SweepPointVsRect(Vector2 from, Vector2 to, Rectangle rect, float &tEnter)
 {
-    // Update player bullets
-    for (int m = m_bullets.size() - 1; m >= 0; m--)
-    {
-        m_bullets[m].position.x += m_bullets[m].motion.x * deltaTime * 60.0f; // Adjust for frame rate
-        m_bullets[m].position.y += m_bullets[m].motion.y * deltaTime * 60.0f;
+    const float origin[2] = {from.x, from.y};
+    const float delta[2] = {to.x - from.x, to.y - from.y};
+    const float low[2] = {rect.x, rect.y};
+    const float high[2] = {rect.x + rect.width, rect.y + rect.height};
 
-        // Check bounds
-        if (m_bullets[m].position.x <= 0 || m_bullets[m].position.y <= 0 ||
-            m_bullets[m].position.x >= 768 || m_bullets[m].position.y >= 768)
+    float tMin = 0.0f;
+    float tMax = 1.0f;
+    for (int axis = 0; axis < 2; axis++)
+    {
+        if (delta[axis] == 0.0f)
         {
-            m_bullets.erase(m_bullets.begin() + m);
+            if (origin[axis] <= low[axis] || origin[axis] >= high[axis])
+                return false;
             continue;
         }
 
-        // Check map collision
-        if (IsCollidingWithMapForBullets(m_bullets[m].position))
+        float t1 = (low[axis] - origin[axis]) / delta[axis];
+        float t2 = (high[axis] - origin[axis]) / delta[axis];
+        if (t1 > t2)
+            std::swap(t1, t2);
+
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+        if (tMin >= tMax)
+            return false;
+    }
+
+    tEnter = tMin;
+    return true;
+}
+
+void PrairieKing::HitMonsterWithBullet(int k, CowboyBullet &bullet)
+{
+    int monsterHealth = m_monsters[k]->health;
+    int monsterAfterDamageHealth = 0;
+
+    if (m_monsters[k]->TakeDamage(bullet.damage))
+    {
+        monsterAfterDamageHealth = m_monsters[k]->health;
+        AddGuts(Vector2{static_cast<float>(m_monsters[k]->position.x),
+                        static_cast<float>(m_monsters[k]->position.y)},
+                m_monsters[k]->type);
+
+        int loot = m_monsters[k]->GetLootDrop();
+
+        // Apply round-based loot modifications
+        if (m_whichRound == 1 && GetRandomFloat(0.0f, 1.0f) < 0.5f)
         {
-            m_bullets.erase(m_bullets.begin() + m);
-            continue;
+            loot = -1; // No loot
         }
 
-        // Check monster collision
-        for (int k = m_monsters.size() - 1; k >= 0; k--)
+        if (m_whichRound > 0 && (loot == POWERUP_ZOMBIE || loot == POWERUP_LIFE) &&
+            GetRandomFloat(0.0f, 1.0f) < 0.4f)
         {
-            Rectangle bulletRect = {
-                static_cast<int>(m_bullets[m].position.x),
-                static_cast<int>(m_bullets[m].position.y),
-                12, 12};
+            loot = -1; // No loot
+        }
 
-            if (CheckCollisionRecs(bulletRect, m_monsters[k]->position))
+        // Handle special Outlaw behavior in shootout levels
+        if (m_shootoutLevel)
+        {
+            // Check if this is the final boss (Dracula) in wave 12
+            if (m_whichWave == 12 && m_monsters[k]->type == DRACULA)
             {
-                int monsterHealth = m_monsters[k]->health;
-                int monsterAfterDamageHealth = 0;
+                PlaySound(GetSound(SoundId::CowboyExplosion));
+                AddPowerup(CowboyPowerup(POWERUP_HEART,
+                                         Vector2{8.0f * GetTileSize(), 10.0f * GetTileSize()}, 9999999));
+                m_noPickUpBox = Rectangle{static_cast<float>(8 * GetTileSize()), static_cast<float>(10 * GetTileSize()), static_cast<float>(GetTileSize()), static_cast<float>(GetTileSize())};
 
-                if (m_monsters[k]->TakeDamage(m_bullets[m].damage))
+                if (IsMusicStreamPlaying(m_outlawSong))
                 {
-                    monsterAfterDamageHealth = m_monsters[k]->health;
-                    AddGuts(Vector2{static_cast<float>(m_monsters[k]->position.x),
-                                    static_cast<float>(m_monsters[k]->position.y)},
-                            m_monsters[k]->type);
+                    StopMusicStream(m_outlawSong);
+                }
 
-                    int loot = m_monsters[k]->GetLootDrop();
+                if (IsMusicStreamPlaying(m_draculaSong))
+                {
+                    StopMusicStream(m_draculaSong);
+                }
 
-                    // Apply round-based loot modifications
-                    if (m_whichRound == 1 && GetRandomFloat(0.0f, 1.0f) < 0.5f)
-                    {
-                        loot = -1; // No loot
-                    }
+                m_screenFlash = 200;
 
-                    if (m_whichRound > 0 && (loot == POWERUP_ZOMBIE || loot == POWERUP_LIFE) &&
-                        GetRandomFloat(0.0f, 1.0f) < 0.4f)
+                // Add multiple explosion effects
+                for (int j = 0; j < 30; j++)
+                {
+                    Vector2 explosionPos = {
+                        static_cast<float>(m_monsters[k]->position.x + GetRandomInt(-GetTileSize(), GetTileSize())),
+                        static_cast<float>(m_monsters[k]->position.y + GetRandomInt(-GetTileSize(), GetTileSize()))};
+
+                    TemporaryAnimatedSprite explosion(
+                        Rectangle{336, 144, 16, 16}, 80.0f, 5, 0,
+                        Vector2{m_topLeftScreenCoordinate.x + explosionPos.x,
+                                m_topLeftScreenCoordinate.y + explosionPos.y},
+                        0.0f, 3.0f, false, 1.0f, WHITE);
+                    explosion.delayBeforeAnimationStart = j * 75;
+                    AddTemporarySprite(explosion);
+
+                    // Add guts effects periodically
+                    if (j % 4 == 0)
                     {
-                        loot = -1; // No loot
+                        AddGuts(Vector2{explosionPos.x, explosionPos.y}, DRACULA);
                     }
 
-                    // Handle special Outlaw behavior in shootout levels
-                    if (m_shootoutLevel)
+                    // Add additional explosion effects
+                    if (j % 4 == 0)
                     {
-                        // Check if this is the final boss (Dracula) in wave 12
-                        if (m_whichWave == 12 && m_monsters[k]->type == DRACULA)
-                        {
-                            PlaySound(GetSound("cowboy_explosion"));
-                            m_powerups.push_back(CowboyPowerup(POWERUP_HEART,
-                                                               Vector2{8.0f * GetTileSize(), 10.0f * GetTileSize()}, 9999999));
-                            m_noPickUpBox = Rectangle{static_cast<float>(8 * GetTileSize()), static_cast<float>(10 * GetTileSize()), static_cast<float>(GetTileSize()), static_cast<float>(GetTileSize())};
-
-                            if (IsMusicStreamPlaying(m_outlawSong))
-                            {
-                                StopMusicStream(m_outlawSong);
-                            }
-
-                            if (IsMusicStreamPlaying(m_draculaSong))
-                            {
-                                StopMusicStream(m_draculaSong);
-                            }
-
-                            m_screenFlash = 200;
-
-                            // Add multiple explosion effects
-                            for (int j = 0; j < 30; j++)
-                            {
-                                Vector2 explosionPos = {
-                                    static_cast<float>(m_monsters[k]->position.x + GetRandomInt(-GetTileSize(), GetTileSize())),
-                                    static_cast<float>(m_monsters[k]->position.y + GetRandomInt(-GetTileSize(), GetTileSize()))};
-
-                                TemporaryAnimatedSprite explosion(
-                                    Rectangle{336, 144, 16, 16}, 80.0f, 5, 0,
-                                    Vector2{m_topLeftScreenCoordinate.x + explosionPos.x,
-                                            m_topLeftScreenCoordinate.y + explosionPos.y},
-                                    0.0f, 3.0f, false, 1.0f, WHITE);
-                                explosion.delayBeforeAnimationStart = j * 75;
-                                AddTemporarySprite(explosion);
-
-                                // Add guts effects periodically
-                                if (j % 4 == 0)
-                                {
-                                    AddGuts(Vector2{explosionPos.x, explosionPos.y}, DRACULA);
-                                }
-
-                                // Add additional explosion effects
-                                if (j % 4 == 0)
-                                {
-                                    TemporaryAnimatedSprite additionalExplosion(
-                                        Rectangle{336, 144, 16, 16}, 80.0f, 5, 0,
-                                        Vector2{m_topLeftScreenCoordinate.x + explosionPos.x,
-                                                m_topLeftScreenCoordinate.y + explosionPos.y},
-                                        0.0f, 3.0f, false, 1.0f, WHITE);
-                                    additionalExplosion.delayBeforeAnimationStart = j * 75;
-                                    AddTemporarySprite(additionalExplosion);
-                                }
-
-                                if (j % 3 == 0)
-                                {
-                                    TemporaryAnimatedSprite flyingEffect(
-                                        Rectangle{336, 144, 16, 16}, 80.0f, 5, 0,
-                                        Vector2{m_topLeftScreenCoordinate.x + explosionPos.x,
-                                                m_topLeftScreenCoordinate.y + explosionPos.y},
-                                        0.0f, 3.0f, false, 1.0f, WHITE);
-                                    flyingEffect.delayBeforeAnimationStart = j * 75;
-                                    AddTemporarySprite(flyingEffect);
-                                }
-                            }
-                        }
-                        // Handle regular Outlaw in other shootout waves (not wave 12)
-                        else if (m_whichWave != 12 && m_monsters[k]->type == -1) // Outlaw type
-                        {
-                            // Drop POWERUP_LOG in first level (world 0), POWERUP_SKULL in second level (world 1)
-                            int powerupType = (m_world == DESERT_WORLD) ? POWERUP_LOG : POWERUP_SKULL;
-
-                            // Add the powerup and a life
-                            m_powerups.push_back(CowboyPowerup(powerupType,
-                                                               Vector2{8.0f * GetTileSize(), 10.0f * GetTileSize()}, 9999999));
-                            m_powerups.push_back(CowboyPowerup(POWERUP_LIFE,
-                                                               Vector2{8.0f * GetTileSize() + GetTileSize(), 10.0f * GetTileSize()}, 9999999));
-
-                            if (IsMusicStreamPlaying(m_outlawSong))
-                            {
-                                StopMusicStream(m_outlawSong);
-                            }
-
-                            // Set bridge tile to allow passage
-                            m_map[8][8] = MAP_BRIDGE;
-                            m_screenFlash = 200;
-
-                            // Add explosion effects
-                            for (int i = 0; i < 15; i++)
-                            {
-                                Vector2 explosionPos = {
-                                    static_cast<float>(m_monsters[k]->position.x + GetRandomInt(-GetTileSize(), GetTileSize())),
-                                    static_cast<float>(m_monsters[k]->position.y + GetRandomInt(-GetTileSize(), GetTileSize()))};
-
-                                TemporaryAnimatedSprite explosion(
-                                    Rectangle{336, 144, 16, 16}, 80.0f, 5, 0,
-                                    Vector2{m_topLeftScreenCoordinate.x + explosionPos.x,
-                                            m_topLeftScreenCoordinate.y + explosionPos.y},
-                                    0.0f, 3.0f, false, 1.0f, WHITE);
-                                explosion.delayBeforeAnimationStart = i * 75;
-                                AddTemporarySprite(explosion);
-                            }
-                            PlaySound(GetSound("outlaw_dead"));
-                        }
+                        TemporaryAnimatedSprite additionalExplosion(
+                            Rectangle{336, 144, 16, 16}, 80.0f, 5, 0,
+                            Vector2{m_topLeftScreenCoordinate.x + explosionPos.x,
+                                    m_topLeftScreenCoordinate.y + explosionPos.y},
+                            0.0f, 3.0f, false, 1.0f, WHITE);
+                        additionalExplosion.delayBeforeAnimationStart = j * 75;
+                        AddTemporarySprite(additionalExplosion);
                     }
-                    // Handle normal loot drops for non-shootout levels
-                    else if (loot != -1 && m_whichWave != 12)
+
+                    if (j % 3 == 0)
                     {
-                        m_powerups.push_back(CowboyPowerup(loot,
-                                                           Vector2{static_cast<float>(m_monsters[k]->position.x),
-                                                                   static_cast<float>(m_monsters[k]->position.y)},
-                                                           LOOT_DURATION));
+                        TemporaryAnimatedSprite flyingEffect(
+                            Rectangle{336, 144, 16, 16}, 80.0f, 5, 0,
+                            Vector2{m_topLeftScreenCoordinate.x + explosionPos.x,
+                                    m_topLeftScreenCoordinate.y + explosionPos.y},
+                            0.0f, 3.0f, false, 1.0f, WHITE);
+                        flyingEffect.delayBeforeAnimationStart = j * 75;
+                        AddTemporarySprite(flyingEffect);
                     }
-
-                    // Remove the monster
-                    delete m_monsters[k];
-                    m_monsters.erase(m_monsters.begin() + k);
-                    PlaySound(GetSound("Cowboy_monsterDie"));
                 }
-                else
+            }
+            // Handle regular Outlaw in other shootout waves (not wave 12)
+            else if (m_whichWave != 12 && m_monsters[k]->type == -1) // Outlaw type
+            {
+                // Drop POWERUP_LOG in first level (world 0), POWERUP_SKULL in second level (world 1)
+                int powerupType = (m_world == DESERT_WORLD) ? POWERUP_LOG : POWERUP_SKULL;
+
+                // Add the powerup and a life
+                AddPowerup(CowboyPowerup(powerupType,
+                                         Vector2{8.0f * GetTileSize(), 10.0f * GetTileSize()}, 9999999));
+                AddPowerup(CowboyPowerup(POWERUP_LIFE,
+                                         Vector2{8.0f * GetTileSize() + GetTileSize(), 10.0f * GetTileSize()}, 9999999));
+
+                if (IsMusicStreamPlaying(m_outlawSong))
                 {
-                    monsterAfterDamageHealth = m_monsters[k]->health;
+                    StopMusicStream(m_outlawSong);
                 }
 
-                // Reduce bullet damage and remove if depleted
-                m_bullets[m].damage -= monsterHealth - monsterAfterDamageHealth;
-                if (m_bullets[m].damage <= 0)
+                // Set bridge tile to allow passage
+                SetMapTile(8, 8, MAP_BRIDGE);
+                m_screenFlash = 200;
+
+                // Add explosion effects
+                for (int i = 0; i < 15; i++)
                 {
-                    m_bullets.erase(m_bullets.begin() + m);
+                    Vector2 explosionPos = {
+                        static_cast<float>(m_monsters[k]->position.x + GetRandomInt(-GetTileSize(), GetTileSize())),
+                        static_cast<float>(m_monsters[k]->position.y + GetRandomInt(-GetTileSize(), GetTileSize()))};
+
+                    TemporaryAnimatedSprite explosion(
+                        Rectangle{336, 144, 16, 16}, 80.0f, 5, 0,
+                        Vector2{m_topLeftScreenCoordinate.x + explosionPos.x,
+                                m_topLeftScreenCoordinate.y + explosionPos.y},
+                        0.0f, 3.0f, false, 1.0f, WHITE);
+                    explosion.delayBeforeAnimationStart = i * 75;
+                    AddTemporarySprite(explosion);
                 }
-                break;
+                PlaySound(GetSound(SoundId::OutlawDead));
             }
         }
+        // Handle normal loot drops for non-shootout levels
+        else if (loot != -1 && m_whichWave != 12)
+        {
+            AddPowerup(CowboyPowerup(loot,
+                                     Vector2{static_cast<float>(m_monsters[k]->position.x),
+                                             static_cast<float>(m_monsters[k]->position.y)},
+                                     LOOT_DURATION));
+        }
+
+        // Remove the monster
+        RemoveMonster(k);
+        PlaySound(GetSound(SoundId::CowboyMonsterDie));
     }
+    else
+    {
+        monsterAfterDamageHealth = m_monsters[k]->health;
+    }
+
+    // Reduce bullet damage
+    bullet.damage -= monsterHealth - monsterAfterDamageHealth;
+}
 
-    // Update enemy bullets (existing code remains the same)
-    for (int i = m_enemyBullets.size() - 1; i >= 0; i--)
+void PrairieKing::UpdateBullets(float deltaTime)
+{
+    // Update player bullets
+    for (int m = m_bullets.size() - 1; m >= 0; m--)
     {
-        // Update bullet position
-        m_enemyBullets[i].position.x += m_enemyBullets[i].motion.x;
-        m_enemyBullets[i].position.y += m_enemyBullets[i].motion.y;
+        // Sweep the bullet over the whole step so hits don't depend on the frame time
+        Vector2 start = m_bullets[m].position;
+        Vector2 end = {start.x + m_bullets[m].motion.x * deltaTime * 60.0f, // Adjust for frame rate
+                       start.y + m_bullets[m].motion.y * deltaTime * 60.0f};
+
+        // Check map collision along the path
+        float wallT = 1.0f;
+        bool hitWall = RaycastTiles(start, end, GetBlockedTiles(LAYER_BULLET), wallT);
+
+        // Check monster collision before the wall, nearest first. Ties go to the most
+        // recently added monster, matching the old reverse scan over m_monsters
+        Rectangle sweptRect = {std::min(start.x, end.x), std::min(start.y, end.y),
+                               fabsf(end.x - start.x) + 12, fabsf(end.y - start.y) + 12};
+        bool hasPreviousHit = false;
+        float previousT = 0.0f;
+        unsigned int previousOrder = 0;
+
+        while (m_bullets[m].damage > 0)
+        {
+            CowboyMonster *target = nullptr;
+            float targetT = 0.0f;
+            auto findTarget = [&](CowboyMonster *monster)
+            {
+                // The bullet is a 12x12 box, so sweep its corner against the monster grown by 12
+                float t = 0.0f;
+                Rectangle grown = {monster->position.x - 12, monster->position.y - 12,
+                                   monster->position.width + 12, monster->position.height + 12};
+                if (!SweepPointVsRect(start, end, grown, t) || (hitWall && t > wallT))
+                    return false;
+
+                // Skip anything already handled earlier in this step
+                if (hasPreviousHit && (t < previousT || (t == previousT && monster->spawnOrder >= previousOrder)))
+                    return false;
+
+                if (target == nullptr || t < targetT || (t == targetT && monster->spawnOrder > target->spawnOrder))
+                {
+                    target = monster;
+                    targetT = t;
+                }
+                return false;
+            };
+            m_monsterGrid.Query(sweptRect, findTarget);
 
-        // Check bounds
-        if (m_enemyBullets[i].position.x <= 0 || m_enemyBullets[i].position.y <= 0 ||
-            m_enemyBullets[i].position.x >= 768 || m_enemyBullets[i].position.y >= 768)
+            if (target == nullptr)
+            {
+                break;
+            }
+
+            hasPreviousHit = true;
+            previousT = targetT;
+            previousOrder = target->spawnOrder;
+
+            int k = static_cast<int>(std::find(m_monsters.begin(), m_monsters.end(), target) - m_monsters.begin());
+            const int damageBefore = m_bullets[m].damage;
+            HitMonsterWithBullet(k, m_bullets[m]);
+
+            // A monster that shrugs the hit off stops the bullet for this step, like the old
+            // one hit per tick; only damage actually spent carries it on to the next monster
+            if (m_bullets[m].damage == damageBefore)
+            {
+                break;
+            }
+        }
+
+        m_bullets[m].position = end;
+
+        // Remove spent bullets, bullets that hit the map and bullets that left the arena
+        if (m_bullets[m].damage <= 0 || hitWall ||
+            end.x <= 0 || end.y <= 0 || end.x >= 768 || end.y >= 768)
         {
-            m_enemyBullets.erase(m_enemyBullets.begin() + i);
-            continue;
+            m_bullets.erase(m_bullets.begin() + m);
         }
+    }
+
+    // Enemy bullets: move them all, drop the ones that left the arena or hit a wall,
+    // then test the survivors against the player LANES at a time
+    m_enemyBullets.Integrate();
+    m_enemyBullets.RemoveIf([this](Vector2 position)
+                            { return position.x <= 0 || position.y <= 0 || position.x >= 768 || position.y >= 768 ||
+                                     IsCollidingWithMap(position, LAYER_BULLET); });
 
-        // Check map collision
-        if (IsCollidingWithMapForBullets(m_enemyBullets[i].position))
+    if (m_godMode || m_playerInvincibleTimer > 0 || m_deathTimer > 0.0f || m_enemyBullets.Empty())
+    {
+        return;
+    }
+
+    m_enemyBulletHitMasks.clear();
+    for (size_t first = 0; first < m_enemyBullets.Size(); first += BulletBatch::LANES)
+    {
+        m_enemyBulletHitMasks.push_back(m_enemyBullets.OverlapMask(first, m_playerBoundingBox, 15.0f));
+    }
+
+    // Resolve newest bullet first like the old reverse loop; the first hit kills and nothing else is processed
+    for (size_t chunk = m_enemyBulletHitMasks.size(); chunk-- > 0;)
+    {
+        uint32_t mask = m_enemyBulletHitMasks[chunk];
+        if (mask == 0)
         {
-            m_enemyBullets.erase(m_enemyBullets.begin() + i);
             continue;
         }
 
-        // Check player collision
-        if (!m_godMode && m_playerInvincibleTimer <= 0 && m_deathTimer <= 0.0f)
+        size_t lane = BulletBatch::LANES - 1;
+        while (((mask >> lane) & 1u) == 0)
         {
-            Rectangle bulletRect = {
-                m_enemyBullets[i].position.x,
-                m_enemyBullets[i].position.y,
-                15, 15};
-
-            if (CheckCollisionRecs(m_playerBoundingBox, bulletRect))
-            {
-                m_enemyBullets.erase(m_enemyBullets.begin() + i);
-                PlayerDie();
-                break; // Important: break after PlayerDie to avoid further processing
-            }
+            lane--;
         }
+        m_enemyBullets.RemoveAt(chunk * BulletBatch::LANES + lane);
+        PlayerDie();
+        break;
     }
 }
 
@@ -1099,7 +1179,7 @@ void PrairieKing::PlayerDie()
         m_spawnQueue[i].clear();
     }
 
-    m_enemyBullets.clear();
+    m_enemyBullets.Clear();
 
     if (!m_shootoutLevel)
     {
@@ -1111,6 +1191,7 @@ void PrairieKing::PlayerDie()
             delete monster;
         }
         m_monsters.clear();
+        m_monsterGrid.Clear();
     }
 
     m_died = true;
@@ -1135,12 +1216,12 @@ void PrairieKing::PlayerDie()
     // Lose a life
     m_lives--;
     m_playerInvincibleTimer = 5000;
-    PlaySound(GetSound("cowboy_dead"));
+    PlaySound(GetSound(SoundId::CowboyDead));
 
     if (m_shootoutLevel)
     {
         m_playerPosition = Vector2{static_cast<float>(8 * GetTileSize()), static_cast<float>(3 * GetTileSize())}; // Fixed Y position
-        PlaySound(GetSound("cowboy_dead"));
+        PlaySound(GetSound(SoundId::CowboyDead));
     }
     else
     {
@@ -1150,7 +1231,7 @@ void PrairieKing::PlayerDie()
             m_playerPosition.y + GetTileSize() / 4.0f,
             static_cast<float>(GetTileSize()) / 2.0f,
             static_cast<float>(GetTileSize()) / 2.0f};
-        PlaySound(GetSound("cowboy_dead"));
+        PlaySound(GetSound(SoundId::CowboyDead));
     }
 
     if (m_lives < 0)
@@ -1199,17 +1280,18 @@ void PrairieKing::AfterPlayerDeathFunction(int extra)
             delete monster;
         }
         m_monsters.clear();
+        m_monsterGrid.Clear();
         m_powerups.clear();
         m_died = false;
 
-        PlaySound(GetSound("Cowboy_monsterDie"));
+        PlaySound(GetSound(SoundId::CowboyMonsterDie));
     }
 }
 
 void PrairieKing::StartNewRound()
 {
     m_gameRestartTimer = 2000;
-    PlaySound(PrairieKing::GetSoundStatic("Cowboy_monsterDie"));
+    PlaySound(PrairieKing::GetSoundStatic(SoundId::CowboyMonsterDie));
     m_whichRound++;
 }
 
@@ -1221,12 +1303,12 @@ void PrairieKing::ProcessInputs()
         if (IsKeyPressed(GameKeys::ShootUp))
         {
             m_gameOverOption = std::max(0, m_gameOverOption - 1);
-            PlaySound(GetSound("Cowboy_gunshot"));
+            PlaySound(GetSound(SoundId::CowboyGunshot));
         }
         if (IsKeyPressed(GameKeys::ShootDown))
         {
             m_gameOverOption = std::min(2, m_gameOverOption + 1); // Changed from 1 to 2
-            PlaySound(GetSound("Cowboy_gunshot"));
+            PlaySound(GetSound(SoundId::CowboyGunshot));
         }
 
         if (IsKeyPressed(GameKeys::SelectOption))
@@ -1239,14 +1321,14 @@ void PrairieKing::ProcessInputs()
                 m_gameRestartTimer = 1500;
                 m_gameOver = false;
                 m_gameOverOption = 0;
-                PlaySound(GetSound("pickup_coin"));
+                PlaySound(GetSound(SoundId::PickupCoin));
                 break;
             case 1: // Back to Main Menu
                 m_shouldReturnToMenu = true;
                 m_gameOver = false;
                 break;
             case 2: // Quit Game
-                CloseWindow();
+                m_closeRequested = true;
                 break;
             }
         }
@@ -1263,7 +1345,7 @@ void PrairieKing::ProcessInputs()
         if (m_gameOver && IsKeyPressed(GameKeys::MoveUp))
         {
             m_gameOverOption = std::max(0, m_gameOverOption - 1);
-            PlaySound(GetSoundStatic("Cowboy_gunshot"));
+            PlaySound(GetSoundStatic(SoundId::CowboyGunshot));
         }
         AddPlayerMovementDirection(0);
     }
@@ -1273,7 +1355,7 @@ void PrairieKing::ProcessInputs()
         if (m_gameOver && IsKeyPressed(GameKeys::MoveDown))
         {
             m_gameOverOption = std::min(1, m_gameOverOption + 1);
-            PlaySound(GetSoundStatic("Cowboy_gunshot"));
+            PlaySound(GetSoundStatic(SoundId::CowboyGunshot));
         }
         AddPlayerMovementDirection(2);
     }
@@ -1466,7 +1548,7 @@ void PrairieKing::SpawnBullets(const std::vector<int> &directions, Vector2 spawn
     }
 
     // Play gunshot sound
-    PlaySound(GetSound("Cowboy_gunshot"));
+    PlaySound(GetSound(SoundId::CowboyGunshot));
 }
 
 bool PrairieKing::IsSpawnQueueEmpty()
@@ -1481,134 +1563,273 @@ bool PrairieKing::IsSpawnQueueEmpty()
     return true;
 }
 
-bool PrairieKing::IsMapTilePassable(int tileType)
+void PrairieKing::LoadMap(int wave)
 {
-    if (tileType <= 1 || (tileType >= 5 && tileType <= 9))
-    {
-        return false;
-    }
-    return true;
+    GetMap(wave, m_map);
+    RebuildPassabilityMasks();
 }
 
-bool PrairieKing::IsMapTilePassableForBullets(int tileType)
+void PrairieKing::SetMap(const int (&newMap)[MAP_WIDTH][MAP_HEIGHT])
 {
-    // Solo las barreras sólidas y las vallas bloquean balas, las trench NO
-    if (tileType <= 1 || tileType == 7)
-    {
-        return false;
-    }
-    return true;
+    memcpy(m_map, newMap, sizeof(m_map));
+    RebuildPassabilityMasks();
 }
 
-bool PrairieKing::IsMapTilePassableForMonsters(int tileType)
+void PrairieKing::SetMapTile(int x, int y, int tileType)
 {
-    if (tileType == 5 || (tileType >= 7 && tileType <= 9))
+    if (!TileMask::InBounds(x, y) || m_map[x][y] == tileType)
     {
-        return false;
+        return;
     }
-    return true;
-}
 
-bool PrairieKing::IsCollidingWithMonster(Rectangle r, CowboyMonster *subject)
-{
-    for (auto monster : m_monsters)
+    m_map[x][y] = tileType;
+    uint8_t layers = GetTileCollisionLayers(tileType);
+    for (int i = 0; i < COLLISION_LAYER_COUNT; i++)
     {
-        if (monster != subject && CheckCollisionRecs(r, monster->position))
-        {
-            // Si el monstruo es un Spikey bloque, es un obstáculo sólido
-            if (monster->type == GameConstants::SPIKEY && monster->spikeyIsBlock)
-                return true;
+        if ((layers >> i) & 1u)
+            m_blockedTiles[i].Set(x, y);
+        else
+            m_blockedTiles[i].Reset(x, y);
+    }
 
-            // Si el monstruo es otro tipo, sigue la lógica normal
-            if (monster->type != GameConstants::SPIKEY)
-                return true;
+    // The flow field is patched lazily, so several edits in one frame share one repair
+    m_dirtyTiles.Set(x, y);
+    m_mapRevision++;
+
+    // The ejection field waits for the next drop too. Only loot lying on a tile that just
+    // became unsafe needs it now
+    m_powerupEjectionDirty = true;
+    if (GetBlockedTiles(LAYER_PLAYER).Test(x, y))
+    {
+        for (auto &powerup : m_powerups)
+        {
+            if (GetPowerupTileX(powerup.position) == x && GetPowerupTileY(powerup.position) == y)
+            {
+                powerup.position = GetPowerupLandingSpot(powerup.position);
+            }
         }
     }
-    return false;
 }
 
-bool PrairieKing::IsCollidingWithMapForMonsters(Rectangle positionToCheck)
+void PrairieKing::LoadNextMap(int wave)
+{
+    GetMap(wave, m_nextMap);
+    m_nextMapRevision++;
+}
+
+Rectangle PrairieKing::GetTileSourceRect(int tileType, int world, int frame)
 {
-    int tileX1 = static_cast<int>(positionToCheck.x) / GetTileSize();
-    int tileY1 = static_cast<int>(positionToCheck.y) / GetTileSize();
-    int tileX2 = static_cast<int>(positionToCheck.x + positionToCheck.width - 1) / GetTileSize();
-    int tileY2 = static_cast<int>(positionToCheck.y + positionToCheck.height - 1) / GetTileSize();
+    // Cactus tiles alternate with the sprite right next to them to dance
+    float danceOffset = (tileType == MAP_CACTUS && frame == 1) ? 16.0f : 0.0f;
+    return Rectangle{336.0f + 16.0f * tileType + danceOffset, 32.0f - world * 16.0f, 16.0f, 16.0f};
+}
 
-    // Check if any part of the monster would be outside the 16x16 map boundaries
-    // Map boundaries are from tile (0,0) to tile (15,15)
-    // For pixel-perfect boundaries, check the actual pixel positions
-    if (positionToCheck.x < 0 || positionToCheck.y < 0 ||
-        positionToCheck.x + positionToCheck.width > 16 * GetTileSize() ||
-        positionToCheck.y + positionToCheck.height > 16 * GetTileSize())
+void PrairieKing::RebuildPassabilityMasks()
+{
+    m_mapRevision++;
+    m_flowFieldDirty = true;
+    for (auto &blocked : m_blockedTiles)
     {
-        return true; // Collision with map boundary
+        blocked.Clear();
     }
 
-    // Check for collisions with impassable tiles within the map
-    for (int y = tileY1; y <= tileY2; y++)
+    for (int x = 0; x < MAP_WIDTH; x++)
     {
-        for (int x = tileX1; x <= tileX2; x++)
+        for (int y = 0; y < MAP_HEIGHT; y++)
         {
-            if (!IsMapTilePassableForMonsters(m_map[x][y]))
+            uint8_t layers = GetTileCollisionLayers(m_map[x][y]);
+            for (int i = 0; i < COLLISION_LAYER_COUNT; i++)
             {
-                return true;
+                if ((layers >> i) & 1u)
+                    m_blockedTiles[i].Set(x, y);
             }
         }
     }
 
-    return false;
+    // Loot already on the ground follows the new layout
+    m_powerupEjectionDirty = true;
+    for (auto &powerup : m_powerups)
+    {
+        powerup.position = GetPowerupLandingSpot(powerup.position);
+    }
 }
 
-bool PrairieKing::IsCollidingWithMapForBullets(Vector2 position)
+void PrairieKing::UpdateFlowField()
 {
-    int tileX = static_cast<int>(position.x) / GetTileSize();
-    int tileY = static_cast<int>(position.y) / GetTileSize();
+    // Fully rebuilt when the player steps onto a new tile or a new map is loaded,
+    // single tile edits (bridge, exit path) are repaired in place
+    int playerTileX = static_cast<int>((m_playerBoundingBox.x + m_playerBoundingBox.width / 2.0f) / GetTileSize());
+    int playerTileY = static_cast<int>((m_playerBoundingBox.y + m_playerBoundingBox.height / 2.0f) / GetTileSize());
+    playerTileX = std::max(0, std::min(MAP_WIDTH - 1, playerTileX));
+    playerTileY = std::max(0, std::min(MAP_HEIGHT - 1, playerTileY));
 
-    if (tileX >= 0 && tileX < MAP_WIDTH && tileY >= 0 && tileY < MAP_HEIGHT)
+    if (m_flowFieldDirty || playerTileX != m_flowField.GetGoalX() || playerTileY != m_flowField.GetGoalY())
+    {
+        m_flowField.Rebuild(GetBlockedTiles(LAYER_WALKER), playerTileX, playerTileY);
+        m_flowFieldDirty = false;
+    }
+    else if (m_dirtyTiles.Any())
     {
-        return !IsMapTilePassableForBullets(m_map[tileX][tileY]);
+        m_flowField.Repair(GetBlockedTiles(LAYER_WALKER), m_dirtyTiles);
     }
-    return true; // Off the map is considered collision
+    m_dirtyTiles.Clear();
 }
 
-bool PrairieKing::IsCollidingWithMap(Rectangle positionToCheck)
+Vector2 PrairieKing::GetFlowFieldTarget(const Rectangle &position, float speed) const
 {
-    int tileX1 = static_cast<int>(positionToCheck.x) / GetTileSize();
-    int tileY1 = static_cast<int>(positionToCheck.y) / GetTileSize();
-    int tileX2 = static_cast<int>(positionToCheck.x + positionToCheck.width - 1) / GetTileSize();
-    int tileY2 = static_cast<int>(positionToCheck.y + positionToCheck.height - 1) / GetTileSize();
+    const float tileSize = static_cast<float>(GetTileSize());
+    int tileX = static_cast<int>(floorf((position.x + position.width / 2.0f) / tileSize));
+    int tileY = static_cast<int>(floorf((position.y + position.height / 2.0f) / tileSize));
+
+    int direction = m_flowField.GetDirection(tileX, tileY);
+    if (direction == FlowField::NO_DIRECTION)
+    {
+        // Already on the player's tile, or nowhere to go: steer straight at them
+        return m_playerPosition;
+    }
+
+    // Line up with the current row/column before turning so the monster fits through
+    bool horizontal = (direction == FlowField::LEFT || direction == FlowField::RIGHT);
+    if (horizontal && fabsf(position.y - tileY * tileSize) > speed)
+    {
+        return {position.x, tileY * tileSize};
+    }
+    if (!horizontal && fabsf(position.x - tileX * tileSize) > speed)
+    {
+        return {tileX * tileSize, position.y};
+    }
+
+    return {(tileX + FlowField::StepX(direction)) * tileSize, (tileY + FlowField::StepY(direction)) * tileSize};
+}
+
+static_assert((PrairieKing::GetTileCollisionLayers(PrairieKing::MAP_CACTUS) & PrairieKing::LAYER_PLAYER) &&
+                  !(PrairieKing::GetTileCollisionLayers(PrairieKing::MAP_TRENCH1) & PrairieKing::LAYER_BULLET) &&
+                  PrairieKing::GetTileCollisionLayers(PrairieKing::MAP_BRIDGE) == 0,
+              "Cactus blocks the player, trenches let bullets through, bridges block nothing");
+static_assert(sizeof(PrairieKing::TILE_COLLISION_LAYERS) == PrairieKing::MAP_BRIDGE + 1 &&
+                  PrairieKing::GetLayerIndex(PrairieKing::LAYER_BULLET) == PrairieKing::COLLISION_LAYER_COUNT - 1,
+              "Every tile type has a collision entry and every layer has a mask");
+static_assert(PrairieKing::IsRectBlocked(TileMask::FromRect(1, 0, 1, 1), Rectangle{48, 0, 48, 48}) &&
+                  !PrairieKing::IsRectBlocked(TileMask::FromRect(1, 0, 1, 1), Rectangle{0, 48, 48, 48}) &&
+                  PrairieKing::IsPointBlocked(TileMask{}, Vector2{-48, 0}),
+              "Rectangle queries test every overlapped tile and treat off-map as blocked");
 
-    for (int y = tileY1; y <= tileY2; y++)
+bool PrairieKing::IsCollidingWithMonster(Rectangle r, CowboyMonster *subject)
+{
+    // Only monsters bucketed near r are tested. Without a subject (spawn checks) the
+    // area is tested as if a walker wanted to stand there
+    uint8_t layer = (subject != nullptr) ? subject->GetCollisionLayer() : LAYER_WALKER;
+    auto blocks = [&](CowboyMonster *monster)
     {
-        for (int x = tileX1; x <= tileX2; x++)
+        return monster != subject && (monster->GetBodyLayers() & layer) != 0 &&
+               CheckCollisionRecs(r, monster->position);
+    };
+    return m_monsterGrid.Query(r, blocks);
+}
+
+bool PrairieKing::RaycastTiles(Vector2 from, Vector2 to, const TileMask &blocked, float &hitT) const
+{
+    // Walk every tile the segment crosses (DDA) and stop at the first blocked one.
+    // Leaving the map counts as a hit
+    const float tileSize = static_cast<float>(GetTileSize());
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    int tileX = static_cast<int>(floorf(from.x / tileSize));
+    int tileY = static_cast<int>(floorf(from.y / tileSize));
+    Vector2 delta = Vector2Subtract(to, from);
+
+    int stepX = (delta.x > 0) ? 1 : ((delta.x < 0) ? -1 : 0);
+    int stepY = (delta.y > 0) ? 1 : ((delta.y < 0) ? -1 : 0);
+    float tDeltaX = (stepX != 0) ? tileSize / fabsf(delta.x) : infinity;
+    float tDeltaY = (stepY != 0) ? tileSize / fabsf(delta.y) : infinity;
+    float tMaxX = (stepX > 0) ? ((tileX + 1) * tileSize - from.x) / delta.x
+                              : ((stepX < 0) ? (tileX * tileSize - from.x) / delta.x : infinity);
+    float tMaxY = (stepY > 0) ? ((tileY + 1) * tileSize - from.y) / delta.y
+                              : ((stepY < 0) ? (tileY * tileSize - from.y) / delta.y : infinity);
+
+    float t = 0.0f;
+    while (true)
+    {
+        if (!TileMask::InBounds(tileX, tileY) || blocked.Test(tileX, tileY))
+        {
+            hitT = t;
+            return true;
+        }
+
+        if (tMaxX > 1.0f && tMaxY > 1.0f)
         {
-            if (x >= 0 && x < MAP_WIDTH && y >= 0 && y < MAP_HEIGHT)
-            {
-                if (!IsMapTilePassable(m_map[x][y]))
-                {
-                    return true;
-                }
-            }
-            else
-            {
-                // Off-map is considered a collision
-                return true;
-            }
+            return false;
+        }
+
+        if (tMaxX < tMaxY)
+        {
+            t = tMaxX;
+            tileX += stepX;
+            tMaxX += tDeltaX;
+        }
+        else
+        {
+            t = tMaxY;
+            tileY += stepY;
+            tMaxY += tDeltaY;
         }
     }
-    return false;
 }
 
-bool PrairieKing::IsCollidingWithMap(Vector2 position)
+int PrairieKing::QueryMonstersInRect(const Rectangle &area, CowboyMonster **out, int capacity, int type) const
+{
+    int count = 0;
+    m_monsterGrid.Query(area, [&](CowboyMonster *monster)
+                        {
+        if ((type == ANY_MONSTER_TYPE || monster->type == type) && CheckCollisionRecs(area, monster->position))
+        {
+            out[count++] = monster;
+        }
+        return count >= capacity; });
+    return count;
+}
+
+int PrairieKing::QueryPowerupsInRect(const Rectangle &area, int *out, int capacity) const
+{
+    const float tileSize = static_cast<float>(GetTileSize());
+    int count = 0;
+    for (int i = static_cast<int>(m_powerups.size()) - 1; i >= 0 && count < capacity; i--)
+    {
+        if (CheckCollisionRecs(area, Rectangle{m_powerups[i].position.x, m_powerups[i].position.y, tileSize, tileSize}))
+        {
+            out[count++] = i;
+        }
+    }
+    return count;
+}
+
+bool PrairieKing::FindRunningGopher(Vector2 &outPosition) const
 {
-    int tileX = static_cast<int>(position.x) / GetTileSize();
-    int tileY = static_cast<int>(position.y) / GetTileSize();
+    if (!m_gopherRunning)
+    {
+        return false;
+    }
+    outPosition = {m_gopherBox.x, m_gopherBox.y};
+    return true;
+}
 
-    if (tileX >= 0 && tileX < MAP_WIDTH && tileY >= 0 && tileY < MAP_HEIGHT)
+bool PrairieKing::IsCollidingWithMap(Rectangle positionToCheck, uint8_t layer)
+{
+    // Layers that may walk over the barrier tiles are kept inside the arena by its pixel bounds
+    if ((layer & ARENA_BOUNDED_LAYERS) != 0 &&
+        (positionToCheck.x < 0 || positionToCheck.y < 0 ||
+         positionToCheck.x + positionToCheck.width > MAP_WIDTH * GetTileSize() ||
+         positionToCheck.y + positionToCheck.height > MAP_HEIGHT * GetTileSize()))
     {
-        return !IsMapTilePassable(m_map[tileX][tileY]);
+        return true;
     }
-    return true; // Off the map is considered collision
+
+    return IsRectBlocked(GetBlockedTiles(layer), positionToCheck);
+}
+
+bool PrairieKing::IsCollidingWithMap(Vector2 position, uint8_t layer)
+{
+    return IsPointBlocked(GetBlockedTiles(layer), position);
 }
 
 void PrairieKing::AddPlayerMovementDirection(int direction)
@@ -1663,56 +1884,46 @@ void PrairieKing::StartShoppingLevel()
         delete monster;
     }
     m_monsters.clear();
+    m_monsterGrid.Clear();
 
     // Enable player movement down to next map
     m_waitingForPlayerToMoveDownAMap = true;
 
     // Clear previous store items
-    m_storeItems.clear();
+    ClearStoreItems();
+
+    Rectangle slotBounds[3];
+    for (int i = 0; i < 3; i++)
+    {
+        slotBounds[i] = Rectangle{static_cast<float>((7 + i) * GetTileSize() + 12 * (i + 1)),
+                                  static_cast<float>(8 * GetTileSize() - GetTileSize() * 2),
+                                  static_cast<float>(GetTileSize()),
+                                  static_cast<float>(GetTileSize())};
+    }
 
     // Add items based on wave
     if (m_whichWave == 2)
     {
         // Wave 2 shop items
-        m_storeItems[Rectangle{static_cast<float>(7 * GetTileSize() + 12),
-                               static_cast<float>(8 * GetTileSize() - GetTileSize() * 2),
-                               static_cast<float>(GetTileSize()),
-                               static_cast<float>(GetTileSize())}] = ITEM_RUNSPEED1;
-
-        m_storeItems[Rectangle{static_cast<float>(8 * GetTileSize() + 24),
-                               static_cast<float>(8 * GetTileSize() - GetTileSize() * 2),
-                               static_cast<float>(GetTileSize()),
-                               static_cast<float>(GetTileSize())}] = ITEM_FIRESPEED1;
-
-        m_storeItems[Rectangle{static_cast<float>(9 * GetTileSize() + 36),
-                               static_cast<float>(8 * GetTileSize() - GetTileSize() * 2),
-                               static_cast<float>(GetTileSize()),
-                               static_cast<float>(GetTileSize())}] = ITEM_AMMO1;
+        AddStoreItem(slotBounds[0], ITEM_RUNSPEED1);
+        AddStoreItem(slotBounds[1], ITEM_FIRESPEED1);
+        AddStoreItem(slotBounds[2], ITEM_AMMO1);
     }
     else
     {
         // Regular shop items based on player levels
-        m_storeItems[Rectangle{static_cast<float>(7 * GetTileSize() + 12),
-                               static_cast<float>(8 * GetTileSize() - GetTileSize() * 2),
-                               static_cast<float>(GetTileSize()),
-                               static_cast<float>(GetTileSize())}] =
-            (m_runSpeedLevel >= 2) ? ITEM_LIFE : (ITEM_RUNSPEED1 + m_runSpeedLevel);
+        AddStoreItem(slotBounds[0],
+                     (m_runSpeedLevel >= 2) ? ITEM_LIFE : (ITEM_RUNSPEED1 + m_runSpeedLevel));
 
-        m_storeItems[Rectangle{static_cast<float>(8 * GetTileSize() + 24),
-                               static_cast<float>(8 * GetTileSize() - GetTileSize() * 2),
-                               static_cast<float>(GetTileSize()),
-                               static_cast<float>(GetTileSize())}] =
-            (m_fireSpeedLevel < 3) ? ITEM_FIRESPEED1 + m_fireSpeedLevel : ((m_ammoLevel >= 3 && !m_spreadPistol) ? ITEM_SPREADPISTOL : ITEM_STAR);
+        AddStoreItem(slotBounds[1],
+                     (m_fireSpeedLevel < 3) ? ITEM_FIRESPEED1 + m_fireSpeedLevel : ((m_ammoLevel >= 3 && !m_spreadPistol) ? ITEM_SPREADPISTOL : ITEM_STAR));
 
-        m_storeItems[Rectangle{static_cast<float>(9 * GetTileSize() + 36),
-                               static_cast<float>(8 * GetTileSize() - GetTileSize() * 2),
-                               static_cast<float>(GetTileSize()),
-                               static_cast<float>(GetTileSize())}] =
-            (m_ammoLevel < 3) ? (ITEM_AMMO1 + m_ammoLevel) : ITEM_STAR;
+        AddStoreItem(slotBounds[2],
+                     (m_ammoLevel < 3) ? (ITEM_AMMO1 + m_ammoLevel) : ITEM_STAR);
     }
 
     // Make sure we have the next map ready
-    GetMap(m_whichWave, m_nextMap);
+    LoadNextMap(m_whichWave);
 }
 
 int PrairieKing::GetPriceForItem(int whichItem) const
@@ -2086,20 +2297,12 @@ void PrairieKing::GetMap(int wave, int (&newMap)[MAP_WIDTH][MAP_HEIGHT])
         }
 
         // Add bridge border
-        Rectangle r = {1, 1, 14, 14};
-        std::vector<Vector2> border = GetBorderPoints(r);
-        for (const auto &pt : border)
-        {
-            newMap[static_cast<int>(pt.x)][static_cast<int>(pt.y)] = MAP_BRIDGE;
-        }
+        TileMask::Outline(1, 1, 14, 14).ForEach([&](int x, int y)
+                                                { newMap[x][y] = MAP_BRIDGE; });
 
         // Add rocky inner border
-        r = {2, 2, 12, 12};
-        border = GetBorderPoints(r);
-        for (const auto &pt : border)
-        {
-            newMap[static_cast<int>(pt.x)][static_cast<int>(pt.y)] = MAP_ROCKY1;
-        }
+        TileMask::Outline(2, 2, 12, 12).ForEach([&](int x, int y)
+                                                { newMap[x][y] = MAP_ROCKY1; });
         return; // Important: return early for wave 12
     }
     break;
@@ -2114,69 +2317,225 @@ void PrairieKing::GetMap(int wave, int (&newMap)[MAP_WIDTH][MAP_HEIGHT])
     }
 }
 
-std::vector<Vector2> PrairieKing::GetBorderPoints(const Rectangle &rect)
+void PrairieKing::RebuildPowerupEjectionField()
 {
-    std::vector<Vector2> points;
-
-    // Add top and bottom borders
-    for (int x = rect.x; x < rect.x + rect.width; x++)
+    // Multi-source BFS out of every safe tile the player can walk to; each unsafe tile
+    // remembers the offset to the safe tile that reached it first. The search only spreads
+    // across walkable tiles, so the way to that tile is open. Walls next to the walkable
+    // area are reached but not walked through; whatever is left after that (inside walls,
+    // pockets the player can't get into) is filled in by going on straight through walls
+    const TileMask &blocked = GetBlockedTiles(LAYER_PLAYER);
+    TileMask unsafe = ARENA_BORDER_TILES | blocked;
+    int queue[MAP_WIDTH * MAP_HEIGHT];
+    int origin[MAP_WIDTH * MAP_HEIGHT];
+    bool visited[MAP_WIDTH][MAP_HEIGHT] = {};
+    int head = 0;
+    int tail = 0;
+
+    // Safe tiles count when they connect to the player's tile. Without a walkable player
+    // tile (between maps) every safe tile does
+    TileMask &reachable = m_powerupReachable;
+    reachable = TileMask();
+    const int playerX = GetPowerupTileX(m_playerPosition);
+    const int playerY = GetPowerupTileY(m_playerPosition);
+    if (!blocked.Test(playerX, playerY))
+    {
+        reachable.Set(playerX, playerY);
+        queue[tail++] = playerY * MAP_WIDTH + playerX;
+        while (head < tail)
+        {
+            int x = queue[head] % MAP_WIDTH;
+            int y = queue[head] / MAP_WIDTH;
+            head++;
+            for (int direction = FlowField::UP; direction <= FlowField::LEFT; direction++)
+            {
+                int nx = x + FlowField::StepX(direction);
+                int ny = y + FlowField::StepY(direction);
+                if (TileMask::InBounds(nx, ny) && !blocked.Test(nx, ny) && !reachable.Test(nx, ny))
+                {
+                    reachable.Set(nx, ny);
+                    queue[tail++] = ny * MAP_WIDTH + nx;
+                }
+            }
+        }
+        head = 0;
+        tail = 0;
+    }
+    else
     {
-        points.push_back({static_cast<float>(x), static_cast<float>(rect.y)});                   // Top
-        points.push_back({static_cast<float>(x), static_cast<float>(rect.y + rect.height - 1)}); // Bottom
+        reachable = ~TileMask();
     }
 
-    // Add left and right borders (excluding corners already added)
-    for (int y = rect.y + 1; y < rect.y + rect.height - 1; y++)
+    for (int x = 0; x < MAP_WIDTH; x++)
     {
-        points.push_back({static_cast<float>(rect.x), static_cast<float>(y)});                  // Left
-        points.push_back({static_cast<float>(rect.x + rect.width - 1), static_cast<float>(y)}); // Right
+        for (int y = 0; y < MAP_HEIGHT; y++)
+        {
+            m_powerupEjection[x][y] = {0, 0};
+            if (!unsafe.Test(x, y) && reachable.Test(x, y))
+            {
+                visited[x][y] = true;
+                origin[y * MAP_WIDTH + x] = y * MAP_WIDTH + x;
+                queue[tail++] = y * MAP_WIDTH + x;
+            }
+        }
     }
 
-    return points;
-}
-
-void PrairieKing::SetButtonState(GameKeys key, bool pressed)
-{
-    if (key == GameKeys::Pause)
+    // Player boxed in with no safe tile around; better any safe tile than none
+    if (tail == 0)
     {
-        m_isPaused = !m_isPaused;
-        std::cout << "Pause screen: " << (m_isPaused ? "ON" : "OFF") << std::endl;
-        return;
+        reachable = ~TileMask();
+        for (int x = 0; x < MAP_WIDTH; x++)
+        {
+            for (int y = 0; y < MAP_HEIGHT; y++)
+            {
+                if (!unsafe.Test(x, y))
+                {
+                    visited[x][y] = true;
+                    origin[y * MAP_WIDTH + x] = y * MAP_WIDTH + x;
+                    queue[tail++] = y * MAP_WIDTH + x;
+                }
+            }
+        }
     }
 
-    // Manejo especial para debug keys (incluye F3-F9 y Numpad 1-9)
-    if ((key >= GameKeys::DebugToggle && key <= GameKeys::DebugClearWave) ||
-        (key >= GameKeys::DebugSpawn1 && key <= GameKeys::DebugSpawn9))
+    // Every tile is queued at most once across both passes, so the second pass only has
+    // to walk the queue from the start again without the walkable check
+    for (int pass = 0; pass < 2; pass++)
     {
-        if (pressed && !IsKeyDown(key))
+        const bool throughWalls = pass == 1;
+        head = 0;
+        while (head < tail)
         {
-            // F3: Toggle debug mode
-            if (key == GameKeys::DebugToggle)
+            int x = queue[head] % MAP_WIDTH;
+            int y = queue[head] / MAP_WIDTH;
+            head++;
+
+            // Walls are reached in the first pass, but only spread in the second
+            if (!throughWalls && blocked.Test(x, y))
             {
-                m_debugMode = !m_debugMode;
-                std::cout << "Debug mode: " << (m_debugMode ? "ON" : "OFF") << std::endl;
-                return;
+                continue;
             }
 
-            if (m_debugMode)
+            for (int direction = FlowField::UP; direction <= FlowField::LEFT; direction++)
             {
-                switch (key)
+                int nx = x + FlowField::StepX(direction);
+                int ny = y + FlowField::StepY(direction);
+                if (!TileMask::InBounds(nx, ny) || visited[nx][ny])
                 {
-                case GameKeys::DebugGodMode:
-                    m_godMode = !m_godMode;
-                    std::cout << "God Mode: " << (m_godMode ? "ON" : "OFF") << std::endl;
-                    break;
-                case GameKeys::DebugAddLife:
-                    m_lives++;
-                    std::cout << "Added life. Total: " << m_lives << std::endl;
-                    break;
-                case GameKeys::DebugAddCoins:
-                    m_coins += 10;
-                    std::cout << "Added 10 coins. Total: " << m_coins << std::endl;
-                    break;
-                case GameKeys::DebugIncDamage:
-                    m_bulletDamage += 100;
-                    std::cout << "Increased damage to: " << m_bulletDamage << std::endl;
+                    continue;
+                }
+
+                int safe = origin[y * MAP_WIDTH + x];
+                visited[nx][ny] = true;
+                origin[ny * MAP_WIDTH + nx] = safe;
+                m_powerupEjection[nx][ny] = {static_cast<int8_t>(safe % MAP_WIDTH - nx),
+                                             static_cast<int8_t>(safe / MAP_WIDTH - ny)};
+                queue[tail++] = ny * MAP_WIDTH + nx;
+            }
+        }
+    }
+
+    m_powerupEjectionDirty = false;
+}
+
+int PrairieKing::GetPowerupTileX(Vector2 position) const
+{
+    const float tileSize = static_cast<float>(GetTileSize());
+    return std::clamp(static_cast<int>(floorf((position.x + tileSize / 2.0f) / tileSize)), 0, MAP_WIDTH - 1);
+}
+
+int PrairieKing::GetPowerupTileY(Vector2 position) const
+{
+    const float tileSize = static_cast<float>(GetTileSize());
+    return std::clamp(static_cast<int>(floorf((position.y + tileSize / 2.0f) / tileSize)), 0, MAP_HEIGHT - 1);
+}
+
+Vector2 PrairieKing::GetPowerupLandingSpot(Vector2 position)
+{
+    // The field points at tiles reachable from where the player stood when it was built
+    if (m_powerupEjectionDirty ||
+        !m_powerupReachable.Test(GetPowerupTileX(m_playerPosition), GetPowerupTileY(m_playerPosition)))
+    {
+        RebuildPowerupEjectionField();
+    }
+
+    const float tileSize = static_cast<float>(GetTileSize());
+    int tileX = GetPowerupTileX(position);
+    int tileY = GetPowerupTileY(position);
+
+    const TileOffset &eject = m_powerupEjection[tileX][tileY];
+    if (eject.x != 0 || eject.y != 0)
+    {
+        return {(tileX + eject.x) * tileSize, (tileY + eject.y) * tileSize};
+    }
+
+    // Safe tile under the middle; just keep the sprite from hanging over the border ring
+    return {std::clamp(position.x, tileSize, (MAP_WIDTH - 2) * tileSize),
+            std::clamp(position.y, tileSize, (MAP_HEIGHT - 2) * tileSize)};
+}
+
+void PrairieKing::AddPowerup(const CowboyPowerup &powerup)
+{
+    m_powerups.push_back(powerup);
+    m_powerups.back().position = GetPowerupLandingSpot(powerup.position);
+}
+
+void PrairieKing::ApplyInput(const InputFrame &input)
+{
+    for (const InputFrame::KeyEvent &event : input.keys)
+    {
+        SetButtonState(event.key, event.pressed);
+    }
+
+    m_pointer = input.pointer;
+    m_pointerPressed = input.pointerPressed;
+    m_screenWidth = input.screenWidth;
+    m_screenHeight = input.screenHeight;
+    m_fps = input.fps;
+}
+
+void PrairieKing::SetButtonState(GameKeys key, bool pressed)
+{
+    if (key == GameKeys::Pause)
+    {
+        m_isPaused = !m_isPaused;
+        std::cout << "Pause screen: " << (m_isPaused ? "ON" : "OFF") << std::endl;
+        return;
+    }
+
+    // Manejo especial para debug keys (incluye F3-F9 y Numpad 1-9)
+    if ((key >= GameKeys::DebugToggle && key <= GameKeys::DebugClearWave) ||
+        (key >= GameKeys::DebugSpawn1 && key <= GameKeys::DebugSpawn9))
+    {
+        if (pressed && !IsKeyDown(key))
+        {
+            // F3: Toggle debug mode
+            if (key == GameKeys::DebugToggle)
+            {
+                m_debugMode = !m_debugMode;
+                std::cout << "Debug mode: " << (m_debugMode ? "ON" : "OFF") << std::endl;
+                return;
+            }
+
+            if (m_debugMode)
+            {
+                switch (key)
+                {
+                case GameKeys::DebugGodMode:
+                    m_godMode = !m_godMode;
+                    std::cout << "God Mode: " << (m_godMode ? "ON" : "OFF") << std::endl;
+                    break;
+                case GameKeys::DebugAddLife:
+                    m_lives++;
+                    std::cout << "Added life. Total: " << m_lives << std::endl;
+                    break;
+                case GameKeys::DebugAddCoins:
+                    m_coins += 10;
+                    std::cout << "Added 10 coins. Total: " << m_coins << std::endl;
+                    break;
+                case GameKeys::DebugIncDamage:
+                    m_bulletDamage += 100;
+                    std::cout << "Increased damage to: " << m_bulletDamage << std::endl;
                     break;
                 case GameKeys::DebugClearMonsters:
                 {
@@ -2186,6 +2545,7 @@ void PrairieKing::SetButtonState(GameKeys key, bool pressed)
                         delete monster;
                     }
                     m_monsters.clear();
+                    m_monsterGrid.Clear();
                     std::cout << "Cleared " << count << " monsters" << std::endl;
                     break;
                 }
@@ -2197,6 +2557,7 @@ void PrairieKing::SetButtonState(GameKeys key, bool pressed)
                     for (auto monster : m_monsters)
                         delete monster;
                     m_monsters.clear();
+                    m_monsterGrid.Clear();
                     std::cout << "Cleared " << count << " monsters" << std::endl;
                     break;
                 }
@@ -2433,126 +2794,10 @@ void PrairieKing::Update(float deltaTime)
         }
     }
 
-    // Update powerups and their timers
+    // Update powerups and their timers. Drops are placed on a safe tile when they spawn,
+    // so nothing here has to push them off the border anymore
     for (int i = m_powerups.size() - 1; i >= 0; i--)
     {
-        // Check if powerup is close to player and in boundary area - eject it inward
-        float distanceToPlayer = Vector2Distance(
-            Vector2{m_playerBoundingBox.x + m_playerBoundingBox.width / 2.0f,
-                    m_playerBoundingBox.y + m_playerBoundingBox.height / 2.0f},
-            Vector2{m_powerups[i].position.x + GetTileSize() / 2.0f,
-                    m_powerups[i].position.y + GetTileSize() / 2.0f});
-
-        // Check if powerup is in boundary area (within 1 tile of edges)
-        bool inBoundaryArea = (m_powerups[i].position.x < GetTileSize() ||
-                               m_powerups[i].position.x >= 15 * GetTileSize() ||
-                               m_powerups[i].position.y < GetTileSize() ||
-                               m_powerups[i].position.y >= 15 * GetTileSize());
-
-        // If powerup is close to player AND in boundary area, push it toward player/center
-        if (distanceToPlayer <= (GetTileSize() + 3) && inBoundaryArea)
-        {
-            Vector2 powerupCenter = {m_powerups[i].position.x + GetTileSize() / 2.0f,
-                                     m_powerups[i].position.y + GetTileSize() / 2.0f};
-            Vector2 playerCenter = {m_playerBoundingBox.x + m_playerBoundingBox.width / 2.0f,
-                                    m_playerBoundingBox.y + m_playerBoundingBox.height / 2.0f};
-
-            // Push powerup toward player center
-            if (powerupCenter.x < playerCenter.x)
-            {
-                m_powerups[i].position.x++;
-            }
-            if (powerupCenter.x > playerCenter.x)
-            {
-                m_powerups[i].position.x--;
-            }
-            if (powerupCenter.y < playerCenter.y)
-            {
-                m_powerups[i].position.y++;
-            }
-            if (powerupCenter.y > playerCenter.y)
-            {
-                m_powerups[i].position.y--;
-            }
-        }
-
-        // Additional boundary ejection system - check if powerup is on border tiles
-        Vector2 tilePosition = {
-            (m_powerups[i].position.x + GetTileSize() / 2.0f) / GetTileSize(),
-            (m_powerups[i].position.y + GetTileSize() / 2.0f) / GetTileSize()};
-
-        // Check corners of the powerup
-        Vector2 corner1 = {m_powerups[i].position.x / GetTileSize(),
-                           m_powerups[i].position.y / GetTileSize()};
-        Vector2 corner2 = {(m_powerups[i].position.x + GetTileSize()) / GetTileSize(),
-                           m_powerups[i].position.y / GetTileSize()};
-        Vector2 corner3 = {m_powerups[i].position.x / GetTileSize(),
-                           (m_powerups[i].position.y + GetTileSize()) / GetTileSize()};
-        Vector2 corner4 = {(m_powerups[i].position.x + GetTileSize()) / GetTileSize(),
-                           (m_powerups[i].position.y + GetTileSize()) / GetTileSize()};
-
-        // Check if any corner is on a border tile (edge of map or impassable)
-        bool onBorderTile = false;
-
-        // Check if on map edges or impassable tiles
-        if (tilePosition.x <= 0 || tilePosition.x >= 15 || tilePosition.y <= 0 || tilePosition.y >= 15 ||
-            corner1.x <= 0 || corner1.x >= 15 || corner1.y <= 0 || corner1.y >= 15 ||
-            corner2.x <= 0 || corner2.x >= 15 || corner2.y <= 0 || corner2.y >= 15 ||
-            corner3.x <= 0 || corner3.x >= 15 || corner3.y <= 0 || corner3.y >= 15 ||
-            corner4.x <= 0 || corner4.x >= 15 || corner4.y <= 0 || corner4.y >= 15)
-        {
-            onBorderTile = true;
-        }
-
-        // Also check if on impassable map tiles
-        if (!onBorderTile && tilePosition.x >= 0 && tilePosition.x < MAP_WIDTH &&
-            tilePosition.y >= 0 && tilePosition.y < MAP_HEIGHT)
-        {
-            int tileType = m_map[static_cast<int>(tilePosition.x)][static_cast<int>(tilePosition.y)];
-            if (!IsMapTilePassable(tileType))
-            {
-                onBorderTile = true;
-            }
-        }
-
-        if (onBorderTile)
-        {
-            // Calculate push direction toward center of map (8, 8)
-            Vector2 pushDirection = {0, 0};
-            float centerX = 8.0f;
-            float centerY = 8.0f;
-
-            if (fabsf(tilePosition.x - centerX) > fabsf(tilePosition.y - centerY))
-            {
-                // Push horizontally toward center
-                pushDirection.x = (tilePosition.x > centerX) ? -1.0f : 1.0f;
-            }
-            else
-            {
-                // Push vertically toward center
-                pushDirection.y = (tilePosition.y > centerY) ? -1.0f : 1.0f;
-            }
-            // Apply the push
-            m_powerups[i].position.x += pushDirection.x;
-            m_powerups[i].position.y += pushDirection.y;
-        }
-
-        // Move powerups toward player if close enough (existing attraction logic)
-        if (CheckCollisionRecs(m_playerBoundingBox,
-                               Rectangle{m_powerups[i].position.x, m_powerups[i].position.y,
-                                         static_cast<float>(GetTileSize()), static_cast<float>(GetTileSize())}))
-        {
-            // Movement logic for powerup attraction
-            Vector2 direction = Vector2Subtract(m_playerPosition, m_powerups[i].position);
-            float length = Vector2Length(direction);
-            if (length > 0)
-            {
-                direction = Vector2Scale(direction, 1.0f / length);
-                m_powerups[i].position = Vector2Add(m_powerups[i].position,
-                                                    Vector2Scale(direction, 5.0f * deltaTime));
-            }
-        }
-
         // Update duration
         m_powerups[i].duration -= deltaTime * 1000.0f;
         if (m_powerups[i].duration <= 0)
@@ -2638,10 +2883,10 @@ void PrairieKing::Update(float deltaTime)
                     else
                     {
                         m_waitingForPlayerToMoveDownAMap = true;
-                        m_map[8][15] = MAP_DESERT;
-                        m_map[7][15] = MAP_DESERT;
-                        m_map[9][15] = MAP_DESERT;
-                        GetMap(m_whichWave, m_nextMap);
+                        SetMapTile(8, 15, MAP_DESERT);
+                        SetMapTile(7, 15, MAP_DESERT);
+                        SetMapTile(9, 15, MAP_DESERT);
+                        LoadNextMap(m_whichWave);
                     }
                 }
             }
@@ -2680,13 +2925,13 @@ void PrairieKing::Update(float deltaTime)
             if (m_merchantBox.y >= 8 * GetTileSize() - GetTileSize() * 3)
             {
                 m_merchantShopOpen = true;
-                PlaySound(GetSound("cowboy_monsterhit"));
+                PlaySound(GetSound(SoundId::CowboyMonsterHit));
 
                 // Clear path tiles
-                m_map[8][15] = MAP_DESERT;
-                m_map[7][15] = MAP_DESERT;
-                m_map[8][14] = MAP_DESERT;
-                m_map[7][14] = MAP_DESERT;
+                SetMapTile(8, 15, MAP_DESERT);
+                SetMapTile(7, 15, MAP_DESERT);
+                SetMapTile(8, 14, MAP_DESERT);
+                SetMapTile(7, 14, MAP_DESERT);
 
                 // Set no pickup area around merchant
                 m_shoppingCarpetNoPickup = Rectangle{
@@ -2700,34 +2945,24 @@ void PrairieKing::Update(float deltaTime)
         // Handle purchases
         if (m_merchantShopOpen)
         {
-            for (auto it = m_storeItems.begin(); it != m_storeItems.end();)
+            int slot = GetStoreItemAt(m_playerBoundingBox);
+            if (slot >= 0 && m_coins >= GetPriceForItem(m_storeItems[slot].item))
             {
-                if (CheckCollisionRecs(m_playerBoundingBox, it->first) &&
-                    m_coins >= GetPriceForItem(it->second))
-                {
-
-                    PlaySound(GetSound("cowboy_secret"));
-                    m_holdItemTimer = 2500;
-                    m_motionPause = 2500;
-                    m_itemToHold = it->second;
+                PlaySound(GetSound(SoundId::CowboySecret));
+                m_holdItemTimer = 2500;
+                m_motionPause = 2500;
+                m_itemToHold = m_storeItems[slot].item;
 
-                    // Remove purchased item
-                    auto toErase = it;
-                    ++it;
-                    m_storeItems.erase(toErase);
+                // Remove purchased item
+                RemoveStoreItem(slot);
 
-                    m_merchantLeaving = true;
-                    m_merchantArriving = false;
-                    m_merchantShopOpen = false;
-                    m_coins -= GetPriceForItem(m_itemToHold);
+                m_merchantLeaving = true;
+                m_merchantArriving = false;
+                m_merchantShopOpen = false;
+                m_coins -= GetPriceForItem(m_itemToHold);
 
-                    // Apply upgrades
-                    ApplyPurchasedUpgrade(m_itemToHold);
-                }
-                else
-                {
-                    ++it;
-                }
+                // Apply upgrades
+                ApplyPurchasedUpgrade(m_itemToHold);
             }
         }
 
@@ -2743,21 +2978,44 @@ void PrairieKing::Update(float deltaTime)
 
                 // Make sure to load the next wave map here
                 // m_whichWave++; // Increment wave since we're moving to the next one
-                GetMap(m_whichWave, m_nextMap); // Load the next map
+                LoadNextMap(m_whichWave); // Load the next map
 
                 // Set up for map transition
                 m_waitingForPlayerToMoveDownAMap = true;
-                m_map[8][15] = MAP_DESERT; // Clear path at the bottom
-                m_map[7][15] = MAP_DESERT;
-                m_map[9][15] = MAP_DESERT;
+                SetMapTile(8, 15, MAP_DESERT); // Clear path at the bottom
+                SetMapTile(7, 15, MAP_DESERT);
+                SetMapTile(9, 15, MAP_DESERT);
             }
         }
     }
 
     // Update game elements
-    for (auto monster : m_monsters)
+    UpdateFlowField();
+    RebuildMonsterGrid();
+    m_movingMonsters = true;
+    for (size_t i = 0; i < m_monsters.size(); i++)
     {
+        CowboyMonster *monster = m_monsters[i];
+        // An ogre earlier in the list may have crushed this one
+        if (monster->removed)
+        {
+            continue;
+        }
         monster->Move(m_playerPosition, deltaTime);
+        m_monsterGrid.Move(monster, monster->position, monster->gridCell);
+    }
+    m_movingMonsters = false;
+
+    if (!m_removedWhileMoving.empty())
+    {
+        m_monsters.erase(std::remove_if(m_monsters.begin(), m_monsters.end(), [](CowboyMonster *monster)
+                                        { return monster->removed; }),
+                         m_monsters.end());
+        for (CowboyMonster *monster : m_removedWhileMoving)
+        {
+            delete monster;
+        }
+        m_removedWhileMoving.clear();
     }
 
     // Handle map scrolling
@@ -2783,7 +3041,7 @@ void PrairieKing::Update(float deltaTime)
         if (m_newMapPosition <= 0)
         {
             m_scrollingMap = false;
-            memcpy(m_map, m_nextMap, sizeof(m_map));
+            SetMap(m_nextMap);
             m_newMapPosition = 16 * GetTileSize();
             m_shopping = false;
             if (!m_shootoutLevel)
@@ -2816,7 +3074,7 @@ void PrairieKing::Update(float deltaTime)
         m_gopherTrainPosition += 3;
         if (m_gopherTrainPosition % 30 == 0)
         {
-            PlaySound(GetSound("Cowboy_Footstep"));
+            PlaySound(GetSound(SoundId::CowboyFootstep));
         }
 
         if (m_playerJumped)
@@ -2835,7 +3093,7 @@ void PrairieKing::Update(float deltaTime)
             m_gopherTrain = false;
             m_playerJumped = false;
             m_whichWave++;
-            GetMap(m_whichWave, m_map);
+            LoadMap(m_whichWave);
             m_playerPosition = {8.0f * GetTileSize(), 8.0f * GetTileSize()};
             if (m_world == 0)
             {
@@ -2882,7 +3140,7 @@ void PrairieKing::Update(float deltaTime)
                     PlayMusicStream(m_endingSong);
                     SetMusicVolume(m_endingSong, 0.7f);
                 }
-                GetMap(-1, m_map); // Get the special end cutscene map
+                LoadMap(-1); // Get the special end cutscene map
                 break;
 
             case 2:
@@ -2919,6 +3177,11 @@ void PrairieKing::Update(float deltaTime)
                 m_playerMotionAnimationTimer = fmod(m_playerMotionAnimationTimer, 400.0f);
         }
 
+        if (m_endCutscenePhase == 5)
+        {
+            UpdateEndMenu();
+        }
+
         return; // Skip normal updates during end cutscene
     }
 }
@@ -2999,250 +3262,34 @@ void PrairieKing::UpdateMonsterChancesForWave()
     }
 }
 
-void PrairieKing::Draw()
+void PrairieKing::Draw(DrawList &list)
 {
-    // Handle end cutscene drawing
+    list.Reset();
+    list.SetTileLayer(DrawList::MAP_LAYER, m_map, m_world, m_mapRevision);
+    list.SetTileLayer(DrawList::NEXT_MAP_LAYER, m_nextMap, m_world, m_nextMapRevision);
 
+    // Handle end cutscene drawing
     if (m_endCutscene)
     {
-        const float texelFix = 0.01f;
-        switch (m_endCutscenePhase)
+        // The first phases still play in the arena; the victory screen is window-sized UI
+        if (m_endCutscenePhase < 4)
         {
-        case 0:
-            // Phase 0: Player holding heart with black background
-            DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), BLACK);
-
-            // Draw player holding heart
-            DrawTexturePro(
-                GetTexture("cursors"),
-                Rectangle{256.0f, 112.0f, 16.0f, 16.0f},
-                Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
-                          m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() / 4.0f,
-                          48.0f, 48.0f},
-                Vector2{0, 0}, 0.0f,
-                (m_endCutsceneTimer < 2000) ? ColorAlpha(WHITE, 1.0f * (static_cast<float>(m_endCutsceneTimer) / 2000.0f)) : WHITE);
-
-            // Draw the heart above player
-            DrawTexturePro(
-                GetTexture("cursors"),
-                Rectangle{192.0f + m_itemToHold * 16.0f, 128.0f, 16.0f, 16.0f},
-                Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
-                          m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() * 2.0f / 3.0f - GetTileSize() / 4.0f,
-                          48.0f, 48.0f},
-                Vector2{0, 0}, 0.0f,
-                (m_endCutsceneTimer < 2000) ? ColorAlpha(WHITE, 1.0f * (static_cast<float>(m_endCutsceneTimer) / 2000.0f)) : WHITE);
-            break;
-
-        case 1:
-        case 2:
-        case 3:
-            // Draw the final map
-            for (int x = 0; x < MAP_WIDTH; x++)
-            {
-                for (int y = 0; y < MAP_HEIGHT; y++)
-                {
-                    float tileOffset = (m_map[x][y] == MAP_CACTUS && m_cactusDanceTimer > 800.0f) ? 16.0f : 0.0f;
-                    DrawTexturePro(
-                        GetTexture("cursors"),
-                        Rectangle{
-                            336.0f + 16.0f * m_map[x][y] + tileOffset + texelFix,
-                            32.0f - m_world * 16.0f + texelFix,
-                            16.0f - 2 * texelFix,
-                            16.0f - 2 * texelFix},
-                        Rectangle{
-                            std::round(m_topLeftScreenCoordinate.x + x * GetTileSize()),
-                            std::round(m_topLeftScreenCoordinate.y + y * GetTileSize() + m_newMapPosition - 16 * GetTileSize()),
-                            static_cast<float>(GetTileSize()),
-                            static_cast<float>(GetTileSize())},
-                        Vector2{0, 0},
-                        0.0f,
-                        WHITE);
-                }
-            }
-
-            // Draw the cowboy statue/monument
-            DrawTexturePro(
-                GetTexture("cursors"),
-                Rectangle{160.0f, 49.0f, 64.0f, 80.0f},
-                Rectangle{m_topLeftScreenCoordinate.x + 6.0f * GetTileSize(),
-                          m_topLeftScreenCoordinate.y + 3.0f * GetTileSize(),
-                          192.0f, 240.0f},
-                Vector2{0, 0}, 0.0f, WHITE);
-
-            if (m_endCutscenePhase == 3)
-            {
-                // Draw kiss
-                DrawTexturePro(
-                    GetTexture("cursors"),
-                    Rectangle{416.0f, 144.0f, 32.0f, 32.0f},
-                    Rectangle{m_topLeftScreenCoordinate.x + 9.0f * GetTileSize(),
-                              m_topLeftScreenCoordinate.y + 7.0f * GetTileSize(),
-                              96.0f, 96.0f},
-                    Vector2{0, 0}, 0.0f, WHITE);
-
-                if (m_endCutsceneTimer < 3000)
-                {
-                    // Fade to black
-                    float alpha = 1.0f - (static_cast<float>(m_endCutsceneTimer) / 3000.0f);
-                    DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), ColorAlpha(BLACK, alpha));
-                }
-            }
-            else
-            {
-                // Draw singing wife
-                int heartFrame = static_cast<int>(-m_endCutsceneTimer / 300) % 4;
-                DrawTexturePro(
-                    GetTexture("cursors"),
-                    Rectangle{96.0f - heartFrame * 16.0f, 144.0f, 16.0f, 16.0f},
-                    Rectangle{m_topLeftScreenCoordinate.x + 10.0f * GetTileSize(),
-                              m_topLeftScreenCoordinate.y + 8.0f * GetTileSize(),
-                              48.0f, 48.0f},
-                    Vector2{0, 0}, 0.0f, WHITE);
-
-                if (m_endCutscenePhase == 2)
-                {
-                    // Draw walking player
-                    DrawTexturePro(
-                        GetTexture("cursors"),
-                        Rectangle{356.0f, 112.0f + static_cast<int>(m_playerMotionAnimationTimer / 100.0f) * 3.0f, 8.0f, 3.0f},
-                        Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x + 4.0f * 3.0f,
-                                  m_topLeftScreenCoordinate.y + m_playerPosition.y + 13.0f * 3.0f,
-                                  24.0f, 9.0f},
-                        Vector2{0, 0}, 0.0f, WHITE);
-
-                    DrawTexturePro(
-                        GetTexture("cursors"),
-                        Rectangle{256.0f, 112.0f, 16.0f, 13.0f},
-                        Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
-                                  m_topLeftScreenCoordinate.y + m_playerPosition.y,
-                                  48.0f, 39.0f},
-                        Vector2{0, 0}, 0.0f, WHITE);
-
-                    // Draw held item
-                    DrawTexturePro(
-                        GetTexture("cursors"),
-                        Rectangle{192.0f + m_itemToHold * 16.0f, 128.0f, 16.0f, 16.0f},
-                        Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
-                                  m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() * 2.0f / 3.0f - GetTileSize() / 4.0f,
-                                  48.0f, 48.0f},
-                        Vector2{0, 0}, 0.0f, WHITE);
-                }
-            }
-
-            break;
-
-        case 4:
-        case 5:
-            // Victory screen with "THE END" message and menu
-            {
-                // Draw black background
-                DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), BLACK);
-
-                // Calculate screen center
-                float centerX = GetScreenWidth() / 2.0f;
-                float centerY = GetScreenHeight() / 2.0f;
-
-                // Calculate THE END logo scale based on screen size (made bigger)
-                float baseWidth = 64.0f;                      // Original sprite width
-                float baseHeight = 48.0f;                     // Original sprite height
-                float targetWidth = GetScreenWidth() * 0.30f; // Increased from 15% to 20% of screen width
-                float scale = targetWidth / baseWidth;
-
-                // Draw THE END logo - moved higher up for better spacing
-                DrawTexturePro(
-                    GetTexture("cursors"),
-                    Rectangle{96.0f, 96.0f, baseWidth, baseHeight},
-                    Rectangle{
-                        centerX - (baseWidth * scale) / 2.0f,
-                        centerY - (baseHeight * scale) / 2.0f - 150.0f, // Moved up from -50 to -120
-                        baseWidth * scale,
-                        baseHeight * scale},
-                    Vector2{0, 0}, 0.0f,
-                    (m_endCutsceneTimer > 0) ? ColorAlpha(WHITE, 1.0f - (static_cast<float>(m_endCutsceneTimer) / 1000.0f))
-                                             : WHITE);
-
-                if (m_endCutscenePhase == 5)
-                {
-                    const char *options[] = {
-                        "Continue to New Game+",
-                        "Back to Main Menu",
-                        "Quit Game"};
-
-                    // Calculate menu positioning with better spacing
-                    float menuStartY = centerY + GetScreenHeight() / 4.0f; // Moved closer to center
-                    float buttonHeight = 60.0f;                            // Increased button height
-                    float buttonSpacing = 30.0f;                           // Increased spacing between buttons
-                    float buttonWidth = 350.0f;                            // Increased button width
-
-                    for (int i = 0; i < 3; i++)
-                    {
-                        // Calculate button position
-                        Rectangle buttonRect = {
-                            centerX - buttonWidth / 2.0f,
-                            menuStartY + (buttonHeight + buttonSpacing) * i,
-                            buttonWidth,
-                            buttonHeight};
-
-                        // Check mouse hover and click
-                        Vector2 mousePos = GetMousePosition();
-                        bool isHovered = CheckCollisionPointRec(mousePos, buttonRect);
-                        Color buttonColor = isHovered ? RED : WHITE;
-
-                        // Draw button background with semi-transparency
-                        DrawRectangleRec(buttonRect,
-                                         ColorAlpha(BLACK, isHovered ? 0.8f : 0.6f));
-
-                        // Draw button border
-                        DrawRectangleLinesEx(buttonRect, 2, buttonColor);
-
-                        // Calculate text position to center it in button
-                        Vector2 textSize = MeasureTextEx(m_assets.GetFont("text"), options[i], 28, 1); // Increased font size
-                        Vector2 textPos = {
-                            buttonRect.x + (buttonRect.width - textSize.x) / 2.0f,
-                            buttonRect.y + (buttonRect.height - textSize.y) / 2.0f};
-
-                        // Draw button text
-                        DrawTextEx(m_assets.GetFont("text"), options[i],
-                                   textPos, 28, 1, buttonColor); // Increased font size from 24 to 28
-
-                        // Handle click
-                        if (isHovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
-                        {
-                            switch (i)
-                            {
-                            case 0: // Continue to New Game+
-                                m_whichRound++;
-                                StartNewRound();
-                                m_endCutscene = false;
-                                m_endCutscenePhase = 0;
-                                break;
-
-                            case 1: // Back to Main Menu
-                                // Set flag to return to main menu instead of setting m_isGameOver
-                                m_shouldReturnToMenu = true;
-                                m_endCutscene = false;
-                                m_endCutscenePhase = 0;
-                                break;
-
-                            case 2: // Quit Game
-                                // Use same quit mechanism as MenuScreen
-                                CloseWindow();
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
-            break;
+            list.BeginPass(DrawList::Pass::World, GetWorldCamera());
         }
-
+        else
+        {
+            list.BeginPass(DrawList::Pass::Screen);
+        }
+        DrawEndCutscene(list);
         return; // Don't draw normal game elements during cutscene
     }
 
     if (m_gameOver || m_gameRestartTimer > 0)
     {
+        list.BeginPass(DrawList::Pass::Hud, GetHudCamera());
+
         // Draw black background
-        DrawRectangle(
+        list.AddRectangle(
             static_cast<int>(m_topLeftScreenCoordinate.x),
             static_cast<int>(m_topLeftScreenCoordinate.y),
             16 * GetTileSize(),
@@ -3255,13 +3302,11 @@ void PrairieKing::Draw()
             m_topLeftScreenCoordinate.x + 6.0f * GetTileSize(),
             m_topLeftScreenCoordinate.y + 7.0f * GetTileSize()};
 
-        // Draw shadows
-        DrawTextEx(m_assets.GetFont("title"), gameOverText,
-                   Vector2{textPos.x - 1, textPos.y}, 48, 1, WHITE);
-        DrawTextEx(m_assets.GetFont("title"), gameOverText,
-                   Vector2{textPos.x + 1, textPos.y}, 48, 1, WHITE);
-        DrawTextEx(m_assets.GetFont("title"), gameOverText,
-                   textPos, 48, 1, WHITE);
+        // Draw shadows (one layout, drawn three times)
+        const TextRun &gameOverRun = m_textCache.Get(m_assets.GetFont(FontId::Title), gameOverText, 48, 1);
+        list.AddText(gameOverRun, Vector2{textPos.x - 1, textPos.y}, WHITE);
+        list.AddText(gameOverRun, Vector2{textPos.x + 1, textPos.y}, WHITE);
+        list.AddText(gameOverRun, textPos, WHITE);
 
         // Draw options with 3 choices
         const char *options[] = {"Retry", "Back to Main Menu", "Quit Game"};
@@ -3279,210 +3324,418 @@ void PrairieKing::Draw()
             // Only draw if not restarting or during blink
             if (m_gameRestartTimer <= 0 || m_gameRestartTimer / 500 % 2 == 0)
             {
-                DrawTextEx(m_assets.GetFont("text"), optionText,
-                           optionPos, 32, 1, WHITE);
+                list.AddText(m_textCache.Get(m_assets.GetFont(FontId::Text), optionText, 32, 1), optionPos, WHITE);
             }
         }
+
         return;
     }
 
-    // 1. Background Layer (layerDepth: 0.0)
-    // Draw the current game map
-    const float texelFix = 0.01f;
-    for (int x = 0; x < MAP_WIDTH; x++)
-    {
-        for (int y = 0; y < MAP_HEIGHT; y++)
-        {
-            DrawTexturePro(
-                GetTexture("cursors"),
-                Rectangle{
-                    336.0f + 16.0f * m_map[x][y] + ((m_map[x][y] == MAP_CACTUS && m_cactusDanceTimer > 800.0f) ? 16.0f : 0.0f) + texelFix,
-                    32.0f - m_world * 16.0f + texelFix,
-                    16.0f - 2 * texelFix,
-                    16.0f - 2 * texelFix},
-                Rectangle{
-                    std::round(m_topLeftScreenCoordinate.x + x * GetTileSize()),
-                    std::round(m_topLeftScreenCoordinate.y + y * GetTileSize() + (m_scrollingMap ? (m_newMapPosition - 16 * GetTileSize()) : 0)),
-                    static_cast<float>(GetTileSize()),
-                    static_cast<float>(GetTileSize())},
-                Vector2{0, 0},
-                0.0f,
-                WHITE);
-        }
-    }
-    // Draw scrolling map if needed
-    if (m_scrollingMap)
+    // 1-3. The arena, drawn at native resolution and upscaled in one pass
+    list.BeginPass(DrawList::Pass::World, GetWorldCamera());
+    const bool showHud = DrawWorld(list);
+
+    if (!showHud)
     {
-        // Draw next map coming in from below - using the buffered next map
-        for (int x = 0; x < MAP_WIDTH; x++)
-        {
-            for (int y = 0; y < MAP_HEIGHT; y++)
-            {
-                DrawTexturePro(
-                    GetTexture("cursors"),
-                    Rectangle{
-                        336.0f + 16.0f * m_nextMap[x][y] + ((m_nextMap[x][y] == MAP_CACTUS && m_cactusDanceTimer > 800.0f) ? 16.0f : 0.0f) + texelFix,
-                        32.0f - m_world * 16.0f + texelFix,
-                        16.0f - 2 * texelFix,
-                        16.0f - 2 * texelFix},
-                    Rectangle{
-                        std::round(m_topLeftScreenCoordinate.x + x * GetTileSize()),
-                        std::round(m_topLeftScreenCoordinate.y + y * GetTileSize() + m_newMapPosition),
-                        static_cast<float>(GetTileSize()),
-                        static_cast<float>(GetTileSize())},
-                    Vector2{0, 0},
-                    0.0f,
-                    WHITE);
-            }
-        }
-
-        // Draw black borders above and below the visible map area
-        DrawRectangle(
-            static_cast<int>(m_topLeftScreenCoordinate.x),
-            -1,
-            16 * GetTileSize(),
-            static_cast<int>(m_topLeftScreenCoordinate.y),
-            BLACK);
+        return;
     }
 
-    // Draw Shop
+    // Arena units again, mapped straight onto the window at the arena's scale
+    list.BeginPass(DrawList::Pass::Hud, GetHudCamera());
+
+    // Text and bars that sit on top of the world sprites
     if (m_shopping)
     {
-        DrawShopping(GetTexture("cursors"), m_topLeftScreenCoordinate);
+        DrawShopPrices(list, m_topLeftScreenCoordinate);
     }
-
-    // 2. Main Game Elements (layerDepth: 0.001 - 0.9)
-    // Draw temporary sprites
-    for (auto &sprite : m_temporarySprites)
+    for (auto monster : m_monsters)
     {
-        sprite.Draw(GetTexture("cursors"));
+        monster->DrawOverlay(list, m_topLeftScreenCoordinate);
     }
 
-    // Draw powerups
-    for (const auto &powerup : m_powerups)
-    {
-        powerup.Draw(GetTexture("cursors"), m_topLeftScreenCoordinate);
-    }
+    // 4. UI Elements (layerDepth: 0.25 - 0.5)
+    // Draw UI background elements
+    list.AddQuad(
+        Rectangle{166.0f, 134.0f, 22.0f, 22.0f},
+        Rectangle{m_topLeftScreenCoordinate.x - (GetTileSize() + 27),
+                  m_topLeftScreenCoordinate.y,
+                  66.0f, 66.0f},
+        WHITE);
 
-    // Draw bullets (layerDepth: 0.9)
-    for (const auto &bullet : m_bullets)
+    // Draw held item
+    if (m_heldItem != nullptr)
     {
-        DrawTexturePro(
-            GetTexture("cursors"),
-            Rectangle{390.0f, 112.0f + (m_bulletDamage - 1) * 4.0f, 4.0f, 4.0f},
-            Rectangle{m_topLeftScreenCoordinate.x + bullet.position.x,
-                      m_topLeftScreenCoordinate.y + bullet.position.y,
-                      12.0f, 12.0f},
-            Vector2{0, 0},
-            0.0f,
+        list.AddQuad(
+            Rectangle{144.0f + m_heldItem->which * 16.0f, 160.0f, 16.0f, 16.0f},
+            Rectangle{m_topLeftScreenCoordinate.x - (GetTileSize() + 18),
+                      m_topLeftScreenCoordinate.y + 9.0f,
+                      48.0f, 48.0f},
             WHITE);
     }
 
-    // Draw enemy bullets (layerDepth: 0.9)
-    for (const auto &bullet : m_enemyBullets)
+    // Draw lives icon and count
+    list.AddQuad(
+        Rectangle{272.0f, 128.0f, 16.0f, 16.0f},
+        Rectangle{m_topLeftScreenCoordinate.x - GetTileSize() * 2,
+                  m_topLeftScreenCoordinate.y + GetTileSize() + 18,
+                  48.0f, 48.0f},
+        WHITE);
+
+    m_livesText.SetNumber(m_assets.GetFont(FontId::Text), "x", std::max(0, m_lives), 32, 1);
+    list.AddText(m_livesText,
+                 Vector2{m_topLeftScreenCoordinate.x - GetTileSize() + 8,
+                         m_topLeftScreenCoordinate.y + GetTileSize() + GetTileSize() / 4 + 18},
+                 WHITE);
+
+    // Draw coins icon and count
+    list.AddQuad(
+        Rectangle{144.0f, 160.0f, 16.0f, 16.0f},
+        Rectangle{m_topLeftScreenCoordinate.x - GetTileSize() * 2,
+                  m_topLeftScreenCoordinate.y + GetTileSize() * 2 + 18,
+                  48.0f, 48.0f},
+        WHITE);
+
+    m_coinsText.SetNumber(m_assets.GetFont(FontId::Text), "x", m_coins, 32, 1);
+    list.AddText(m_coinsText,
+                 Vector2{m_topLeftScreenCoordinate.x - GetTileSize() + 8,
+                         m_topLeftScreenCoordinate.y + GetTileSize() * 2 + GetTileSize() / 4 + 18},
+                 WHITE);
+
+    // Draw wave progress indicators
+    for (int i = 0; i < m_whichWave + m_whichRound * 12; i++)
     {
-        DrawTexturePro(
-            GetTexture("cursors"),
-            Rectangle{395.0f, 112.0f, 5.0f, 5.0f},
-            Rectangle{m_topLeftScreenCoordinate.x + bullet.position.x,
-                      m_topLeftScreenCoordinate.y + bullet.position.y,
+        list.AddQuad(
+            Rectangle{384.0f, 112.0f, 5.0f, 5.0f},
+            Rectangle{m_topLeftScreenCoordinate.x + GetTileSize() * 16 + 3,
+                      m_topLeftScreenCoordinate.y + static_cast<float>(i * 3 * 6),
                       15.0f, 15.0f},
-            Vector2{0, 0},
-            0.0f,
             WHITE);
     }
 
-    // 3. Characters and Monsters (layerDepth: ~0.001 - 0.002 + position.Y/10000f)
-    // Draw player
-    if (m_deathTimer <= 0.0f && (m_playerInvincibleTimer <= 0 || m_playerInvincibleTimer / 100 % 2 == 0))
-    {
-        if (m_holdItemTimer > 0)
-        {
-            // Draw player holding item
-            DrawTexturePro(
-                GetTexture("cursors"),
-                Rectangle{256.0f, 112.0f, 16.0f, 16.0f},
-                Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
-                          m_topLeftScreenCoordinate.y + m_playerPosition.y,
-                          48.0f, 48.0f},
-                Vector2{0, 0},
-                0.0f,
-                WHITE);
+    // Draw timer bar
+    list.AddQuad(
+        Rectangle{467.0f, 100.0f, 9.0f, 11.0f},
+        Rectangle{m_topLeftScreenCoordinate.x,
+                  m_topLeftScreenCoordinate.y - GetTileSize() / 2 - 12,
+                  27.0f, 33.0f},
+        WHITE);
+
+    // Draw the timer bar - show full when not in active wave, actual timer when in active wave
+    if (!m_shootoutLevel && m_betweenWaveTimer <= 0 && !m_shopping &&
+        !m_merchantArriving && !m_merchantLeaving && !m_waitingForPlayerToMoveDownAMap)
+    {
+        // Active wave state - show actual timer
+        Color timerColor = (m_waveTimer < 8000) ? Color{188, 51, 74, 255} : Color{147, 177, 38, 255};
+
+        int timerWidth = static_cast<int>((16 * GetTileSize() - 60) *
+                                          (static_cast<float>(m_waveTimer) / WAVE_DURATION));
+        timerWidth = std::min(timerWidth, 16 * GetTileSize() - 60);
+
+        list.AddRectangle(
+            static_cast<int>(m_topLeftScreenCoordinate.x + 30),
+            static_cast<int>(m_topLeftScreenCoordinate.y - GetTileSize() / 2 + 3),
+            timerWidth,
+            GetTileSize() / 4,
+            timerColor);
+    }
+    else if (!m_shootoutLevel)
+    {
+        if (m_died)
+        {
+            Color timerColor = (m_waveTimer < 8000) ? Color{188, 51, 74, 255} : Color{147, 177, 38, 255};
+
+            int timerWidth = static_cast<int>((16 * GetTileSize() - 60) *
+                                              (static_cast<float>(m_waveTimer) / WAVE_DURATION));
+            timerWidth = std::min(timerWidth, 16 * GetTileSize() - 60);
+
+            list.AddRectangle(
+                static_cast<int>(m_topLeftScreenCoordinate.x + 30),
+                static_cast<int>(m_topLeftScreenCoordinate.y - GetTileSize() / 2 + 3),
+                timerWidth,
+                GetTileSize() / 4,
+                timerColor);
+        }
+        else
+        {
+            // Not in active wave state - show full timer bar
+            list.AddRectangle(
+                static_cast<int>(m_topLeftScreenCoordinate.x + 30),
+                static_cast<int>(m_topLeftScreenCoordinate.y - GetTileSize() / 2 + 3),
+                16 * GetTileSize() - 60, // Full width
+                GetTileSize() / 4,
+                Color{147, 177, 38, 255}); // Green color (same as when timer > 8000)
+        }
+    }
+
+    // Draw powerup indicators
+    if (m_bulletDamage > 1)
+    {
+        list.AddQuad(
+            Rectangle{288.0f + (m_ammoLevel - 1) * 16.0f, 128.0f, 16.0f, 16.0f},
+            Rectangle{m_topLeftScreenCoordinate.x - GetTileSize() - 3,
+                      m_topLeftScreenCoordinate.y + 16 * GetTileSize() - GetTileSize(),
+                      48.0f, 48.0f},
+            WHITE);
+    }
+
+    if (m_fireSpeedLevel > 0)
+    {
+        list.AddQuad(
+            Rectangle{192.0f + (m_fireSpeedLevel - 1) * 16.0f, 128.0f, 16.0f, 16.0f},
+            Rectangle{m_topLeftScreenCoordinate.x - GetTileSize() - 3,
+                      m_topLeftScreenCoordinate.y + 16 * GetTileSize() - GetTileSize() * 2,
+                      48.0f, 48.0f},
+            WHITE);
+    }
+
+    if (m_runSpeedLevel > 0)
+    {
+        list.AddQuad(
+            Rectangle{240.0f + (m_runSpeedLevel - 1) * 16.0f, 128.0f, 16.0f, 16.0f},
+            Rectangle{m_topLeftScreenCoordinate.x - GetTileSize() - 3,
+                      m_topLeftScreenCoordinate.y + 16 * GetTileSize() - GetTileSize() * 3,
+                      48.0f, 48.0f},
+            WHITE);
+    }
+
+    if (m_spreadPistol)
+    {
+        list.AddQuad(
+            Rectangle{336.0f, 128.0f, 16.0f, 16.0f},
+            Rectangle{m_topLeftScreenCoordinate.x - GetTileSize() - 3,
+                      m_topLeftScreenCoordinate.y + 16 * GetTileSize() - GetTileSize() * 4,
+                      48.0f, 48.0f},
+            WHITE);
+    }
+
+    // Draw screen flash effect if active
+    if (m_screenFlash > 0)
+    {
+        list.AddRectangle(
+            static_cast<int>(m_topLeftScreenCoordinate.x),
+            static_cast<int>(m_topLeftScreenCoordinate.y),
+            16 * GetTileSize(),
+            16 * GetTileSize(),
+            ColorAlpha(RAYWHITE, static_cast<float>(m_screenFlash) / 1000.0f));
+    }
+
+    if (m_waitingForPlayerToMoveDownAMap && (m_merchantShopOpen || m_merchantLeaving || !m_shopping) && m_shoppingTimer < 250)
+    {
+        // Draw the arrow at the bottom of the screen
+        list.AddQuad(
+            Rectangle{227.0f, 102.0f, 8.0f, 8.0f},
+            Rectangle{m_topLeftScreenCoordinate.x + 8.5f * GetTileSize() - 12,
+                      m_topLeftScreenCoordinate.y + 15.0f * GetTileSize(),
+                      24.0f, 24.0f},
+            WHITE);
+    }
+
+    if (m_debugMode)
+    {
+        DrawDebugGrid(list);
+        DrawDebugHitboxes(list);
+    }
+
+    list.BeginPass(DrawList::Pass::Screen);
+
+    // Draw control instructions at beginning of game
+
+    if (m_betweenWaveTimer > 0 && m_whichWave == 0 && !m_scrollingMap)
+    {
+        Vector2 pos = {m_screenWidth / 2.6, m_screenHeight - 138 - 3};
+        Vector2 pos2 = {m_screenWidth / 1.89, m_screenHeight - 138 - 3};
+        Vector2 pos3 = {m_screenWidth / 1.89, m_screenHeight - 81 - 3};
+
+        // Drawing controls instruction box
+
+        list.AddQuad(
+            Rectangle{224, 0, 80, 48},
+            Rectangle{pos.x, pos.y, 240, 144},
+            WHITE);
+
+        // Drawing pause instruction box
+
+        list.AddQuad(
+            Rectangle{119, 0, 41, 17},
+            Rectangle{pos2.x, pos2.y, 150, 54},
+            WHITE);
+
+        // Drawing debug instruction box
+
+        list.AddQuad(
+            Rectangle{74, 0, 45, 19},
+            Rectangle{pos3.x, pos3.y, 151, 55},
+            WHITE);
+    }
+
+    DrawDebugInfo(list);
+
+    // Draw pause overlay if paused
+    if (m_isPaused)
+    {
+        // Draw semi-transparent overlay
+        list.AddRectangle(0, 0, m_screenWidth, m_screenHeight, 
+                          ColorAlpha(BLACK, 0.7f));
+        
+        float centerX = m_screenWidth / 2.0f;
+        float centerY = m_screenHeight / 2.0f;
+        
+        // Draw "PAUSED" text
+        const TextRun &pausedRun = m_textCache.Get(m_assets.GetFont(FontId::Title), "PAUSED", 48, 1);
+        list.AddText(pausedRun, Vector2{centerX - pausedRun.GetSize().x / 2, centerY - 100}, WHITE);
+        
+        if (!m_showPauseSettings)
+        {
+            // Draw pause menu options
+            const char *options[] = {"Resume", "Settings", "Back to Main Menu"};
+            
+            for (int i = 0; i < 3; i++)
+            {
+                const char *optionText = TextFormat("%s%s", 
+                    m_pauseOption == i ? "> " : "  ", options[i]);
+                
+                Vector2 optionPos = {
+                    centerX - 100,
+                    centerY + (i * 40.0f)
+                };
+                
+                list.AddText(m_textCache.Get(m_assets.GetFont(FontId::Text), optionText, 32, 1), optionPos, WHITE);
+            }
+        }
+        else
+        {
+            // Draw settings menu (simplified version)
+            list.AddText(m_textCache.Get(m_assets.GetFont(FontId::Text), "Settings (Press ESC to go back)", 24, 1),
+                         Vector2{centerX - 150, centerY}, WHITE);
+        }
+    }
+}
+
+// Returns false when the arena covers the whole screen this frame (zombie
+// transformation, gopher train) and the HUD should not be drawn
+bool PrairieKing::DrawWorld(DrawList &list)
+{
+    // 1. Background Layer (layerDepth: 0.0)
+    // Draw the current game map, pre-rendered and only rebuilt when the map changes
+    const int cactusFrame = (m_cactusDanceTimer > 800.0f) ? 1 : 0;
+    list.AddTileLayer(DrawList::MAP_LAYER,
+                      Vector2{m_topLeftScreenCoordinate.x,
+                              m_topLeftScreenCoordinate.y + (m_scrollingMap ? (m_newMapPosition - 16 * GetTileSize()) : 0)},
+                      static_cast<float>(PIXEL_ZOOM), cactusFrame);
+
+    // Draw scrolling map if needed. The part scrolled out of the arena falls outside the
+    // virtual screen, so it needs no masking
+    if (m_scrollingMap)
+    {
+        // Draw next map coming in from below - using the buffered next map
+        list.AddTileLayer(DrawList::NEXT_MAP_LAYER,
+                          Vector2{m_topLeftScreenCoordinate.x, m_topLeftScreenCoordinate.y + m_newMapPosition},
+                          static_cast<float>(PIXEL_ZOOM), cactusFrame);
+    }
+
+    // 2. World sprites: queued with their layer depth and drawn in one sorted batch
+
+    // Merchant and shop counter
+    if (m_shopping)
+    {
+        DrawShopping(list, m_topLeftScreenCoordinate);
+    }
+
+    // Temporary sprites use their own layerDepth (guts 0.001, explosions 1.0). Plain
+    // effects on top of everything are left to DrawParticles
+    for (const auto &sprite : m_temporarySprites)
+    {
+        if (!IsInstancedParticle(sprite))
+        {
+            sprite.Draw(list);
+        }
+    }
+
+    // Draw powerups
+    for (const auto &powerup : m_powerups)
+    {
+        powerup.Draw(list, m_topLeftScreenCoordinate);
+    }
+
+    // 3. Characters and Monsters (layerDepth: ~0.001 - 0.002 + position.Y/10000f)
+    const float playerDepth = GetCharacterDepth(m_playerPosition.y);
+
+    // Draw player
+    if (m_deathTimer <= 0.0f && (m_playerInvincibleTimer <= 0 || m_playerInvincibleTimer / 100 % 2 == 0))
+    {
+        if (m_holdItemTimer > 0)
+        {
+            // Draw player holding item
+            list.AddSprite(
+                Rectangle{256.0f, 112.0f, 16.0f, 16.0f},
+                Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
+                          m_topLeftScreenCoordinate.y + m_playerPosition.y,
+                          48.0f, 48.0f},
+                playerDepth);
 
             // Draw held item above player
-            DrawTexturePro(
-                GetTexture("cursors"),
+            list.AddSprite(
                 Rectangle{192.0f + m_itemToHold * 16.0f, 128.0f, 16.0f, 16.0f},
                 Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
                           m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() / 2,
                           48.0f, 48.0f},
-                Vector2{0, 0},
-                0.0f,
-                WHITE);
+                playerDepth);
         }
         else if (m_zombieModeTimer > 8200)
         {
+            // The transformation blacks out the arena, so nothing queued so far is visible
+            list.ClearSprites();
+
             // Draw black background during transformation
-            DrawRectangle(
+            list.AddRectangle(
                 static_cast<int>(m_topLeftScreenCoordinate.x),
                 static_cast<int>(m_topLeftScreenCoordinate.y),
                 16 * GetTileSize(), 16 * GetTileSize(),
                 BLACK);
 
             // Draw flashing player sprite during transformation
-            DrawTexturePro(
-                GetTexture("cursors"),
+            list.AddSprite(
                 Rectangle{256.0f + ((static_cast<int>(m_zombieModeTimer / 200) % 2 == 0) ? 16.0f : 0.0f),
                           112.0f, 16.0f, 16.0f},
                 Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
                           m_topLeftScreenCoordinate.y + m_playerPosition.y,
                           48.0f, 48.0f},
-                Vector2{0, 0},
-                0.0f,
-                WHITE);
+                playerDepth);
 
             // Draw rising effect
             for (float y = m_playerPosition.y - GetTileSize(); y > -GetTileSize(); y -= GetTileSize())
             {
-                DrawTexturePro(
-                    GetTexture("cursors"),
+                list.AddSprite(
                     Rectangle{240.0f + ((static_cast<int>(y / GetTileSize()) % 3 == 0) ? 16.0f : 0.0f),
                               96.0f, 16.0f, 16.0f},
                     Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
                               m_topLeftScreenCoordinate.y + y,
                               48.0f, 48.0f},
-                    Vector2{0, 0},
-                    0.0f,
-                    WHITE);
+                    EFFECT_DEPTH);
             }
-            return;
+            list.FlushSprites();
+            return false;
         }
         else if (m_zombieModeTimer > 0)
         {
             // Draw zombie player during active mode
-            DrawTexturePro(
-                GetTexture("cursors"),
+            list.AddSprite(
                 Rectangle{224.0f + ((static_cast<int>(m_zombieModeTimer / 50) % 2 == 0) ? 16.0f : 0.0f),
                           112.0f, 16.0f, 16.0f},
                 Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
                           m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() / 4,
                           48.0f, 48.0f},
-                Vector2{0, 0},
-                0.0f,
-                WHITE);
+                playerDepth);
         }
         else if (m_playerMovementDirections.empty() && m_playerShootingDirections.empty())
         {
             // Draw idle player
-            DrawTexturePro(
-                GetTexture("cursors"),
+            list.AddSprite(
                 Rectangle{368.0f, 112.0f, 16.0f, 16.0f},
                 Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
                           m_topLeftScreenCoordinate.y + m_playerPosition.y,
                           48.0f, 48.0f},
-                Vector2{0, 0},
-                0.0f,
-                WHITE);
+                playerDepth);
         }
         else
         {
@@ -3507,26 +3760,20 @@ void PrairieKing::Draw()
                 footFrame = 0;
             }
 
-            DrawTexturePro(
-                GetTexture("cursors"),
+            list.AddSprite(
                 Rectangle{355.0f, 112.0f + footFrame * 3.0f, 10.0f, 3.0f},
                 Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x + 9.0f,
                           m_topLeftScreenCoordinate.y + m_playerPosition.y + 39.0f,
                           30.0f, 9.0f},
-                Vector2{0, 0},
-                0.0f,
-                WHITE);
+                playerDepth);
 
-            // Draw player body
-            DrawTexturePro(
-                GetTexture("cursors"),
+            // Draw player body (same depth, queued after the feet so it stays on top)
+            list.AddSprite(
                 Rectangle{336.0f + facingDirection * 16.0f, 96.0f, 16.0f, 16.0f},
                 Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
                           m_topLeftScreenCoordinate.y + m_playerPosition.y,
                           48.0f, 48.0f},
-                Vector2{0, 0},
-                0.0f,
-                WHITE);
+                playerDepth);
         }
     }
 
@@ -3534,421 +3781,391 @@ void PrairieKing::Draw()
     if (m_zombieModeTimer > 8200)
     {
         // Draw zombie player sprite
-        DrawTexturePro(
-            GetTexture("cursors"),
+        list.AddSprite(
             Rectangle{256.0f + ((static_cast<int>(m_zombieModeTimer) / 200 % 2 == 0) ? 16.0f : 0.0f), 112.0f, 16.0f, 16.0f},
             Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
                       m_topLeftScreenCoordinate.y + m_playerPosition.y,
                       48.0f, 48.0f},
-            Vector2{0, 0},
-            0.0f,
-            WHITE);
+            playerDepth);
 
         // Draw rising effects
         for (float y = m_playerPosition.y - GetTileSize(); y > -GetTileSize(); y -= GetTileSize())
         {
-            DrawTexturePro(
-                GetTexture("cursors"),
+            list.AddSprite(
                 Rectangle{240.0f + ((static_cast<int>(y / GetTileSize()) % 3 == 0) ? 16.0f : 0.0f),
                           64.0f, 16.0f, 16.0f},
                 Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
                           m_topLeftScreenCoordinate.y + y,
                           48.0f, 48.0f},
-                Vector2{0, 0},
-                0.0f,
-                WHITE);
+                EFFECT_DEPTH);
         }
     }
 
     // Draw monsters
     for (auto monster : m_monsters)
     {
-        monster->Draw(GetTexture("cursors"), m_topLeftScreenCoordinate);
+        monster->Draw(list, m_topLeftScreenCoordinate);
     }
 
-    // 4. UI Elements (layerDepth: 0.25 - 0.5)
-    // Draw UI background elements
-    DrawTexturePro(
-        GetTexture("cursors"),
-        Rectangle{166.0f, 134.0f, 22.0f, 22.0f},
-        Rectangle{m_topLeftScreenCoordinate.x - (GetTileSize() + 27),
-                  m_topLeftScreenCoordinate.y,
-                  66.0f, 66.0f},
-        Vector2{0, 0},
-        0.0f,
-        WHITE);
+    // Bullets (layerDepth: 0.9) go in between the depth ranges of the batch
+    list.FlushSprites(BULLET_DEPTH);
+    DrawBullets(list);
+    list.FlushSprites();
+    DrawParticles(list);
 
-    // Draw held item
-    if (m_heldItem != nullptr)
+    // The gopher train rolls over a blacked out arena and hides the HUD
+    if (m_gopherTrain && m_gopherTrainPosition > -GetTileSize())
     {
-        DrawTexturePro(
-            GetTexture("cursors"),
-            Rectangle{144.0f + m_heldItem->which * 16.0f, 160.0f, 16.0f, 16.0f},
-            Rectangle{m_topLeftScreenCoordinate.x - (GetTileSize() + 18),
-                      m_topLeftScreenCoordinate.y + 9.0f,
-                      48.0f, 48.0f},
-            Vector2{0, 0},
-            0.0f,
-            WHITE);
-    }
+        list.Clear(BLACK);
 
-    // Draw lives icon and count
-    DrawTexturePro(
-        GetTexture("cursors"),
-        Rectangle{272.0f, 128.0f, 16.0f, 16.0f},
-        Rectangle{m_topLeftScreenCoordinate.x - GetTileSize() * 2,
-                  m_topLeftScreenCoordinate.y + GetTileSize() + 18,
-                  48.0f, 48.0f},
-        Vector2{0, 0},
-        0.0f,
-        WHITE);
-
-    DrawTextEx(m_assets.GetFont("text"),
-               ("x" + std::to_string(std::max(0, m_lives))).c_str(),
-               Vector2{m_topLeftScreenCoordinate.x - GetTileSize() + 8,
-                       m_topLeftScreenCoordinate.y + GetTileSize() + GetTileSize() / 4 + 18},
-               32, // Font size
-               1,
-               WHITE);
-
-    // Draw coins icon and count
-    DrawTexturePro(
-        GetTexture("cursors"),
-        Rectangle{144.0f, 160.0f, 16.0f, 16.0f},
-        Rectangle{m_topLeftScreenCoordinate.x - GetTileSize() * 2,
-                  m_topLeftScreenCoordinate.y + GetTileSize() * 2 + 18,
-                  48.0f, 48.0f},
-        Vector2{0, 0},
-        0.0f,
-        WHITE);
+        // Draw gopher train cars
+        Rectangle gopherCarRect = {256 + (m_gopherTrainPosition / 30 % 4) * 16, 144, 16, 16};
 
-    DrawTextEx(m_assets.GetFont("text"),
-               ("x" + std::to_string(m_coins)).c_str(),
-               Vector2{m_topLeftScreenCoordinate.x - GetTileSize() + 8,
-                       m_topLeftScreenCoordinate.y + GetTileSize() * 2 + GetTileSize() / 4 + 18},
-               32, // Font size
-               1,
-               WHITE);
+        list.AddQuad(gopherCarRect,
+                     Rectangle{
+                         m_topLeftScreenCoordinate.x + m_playerPosition.x - GetTileSize() / 2.0f,
+                         m_topLeftScreenCoordinate.y + m_gopherTrainPosition,
+                         48.0f, 48.0f}, // Properly scaled to 48x48 (16 * 3)
+                     WHITE);
 
-    // Draw wave progress indicators
-    for (int i = 0; i < m_whichWave + m_whichRound * 12; i++)
-    {
-        DrawTexturePro(
-            GetTexture("cursors"),
-            Rectangle{384.0f, 112.0f, 5.0f, 5.0f},
-            Rectangle{m_topLeftScreenCoordinate.x + GetTileSize() * 16 + 3,
-                      m_topLeftScreenCoordinate.y + static_cast<float>(i * 3 * 6),
-                      15.0f, 15.0f},
-            Vector2{0, 0},
-            0.0f,
-            WHITE);
-    }
+        list.AddQuad(gopherCarRect,
+                     Rectangle{
+                         m_topLeftScreenCoordinate.x + m_playerPosition.x + GetTileSize() / 2.0f,
+                         m_topLeftScreenCoordinate.y + m_gopherTrainPosition,
+                         48.0f, 48.0f}, // Properly scaled to 48x48 (16 * 3)
+                     WHITE);
 
-    // Draw timer bar
-    DrawTexturePro(
-        GetTexture("cursors"),
-        Rectangle{467.0f, 100.0f, 9.0f, 11.0f},
-        Rectangle{m_topLeftScreenCoordinate.x,
-                  m_topLeftScreenCoordinate.y - GetTileSize() / 2 - 12,
-                  27.0f, 33.0f},
-        Vector2{0, 0},
-        0.0f,
-        WHITE);
-
-    // Draw the timer bar - show full when not in active wave, actual timer when in active wave
-    if (!m_shootoutLevel && m_betweenWaveTimer <= 0 && !m_shopping &&
-        !m_merchantArriving && !m_merchantLeaving && !m_waitingForPlayerToMoveDownAMap)
-    {
-        // Active wave state - show actual timer
-        Color timerColor = (m_waveTimer < 8000) ? Color{188, 51, 74, 255} : Color{147, 177, 38, 255};
+        // Draw gopher engine
+        Rectangle gopherEngineRect = {192 + (m_gopherTrainPosition / 30 % 4) * 16, 144, 16, 16};
+        list.AddQuad(gopherEngineRect,
+                     Rectangle{
+                         m_topLeftScreenCoordinate.x + m_playerPosition.x,
+                         m_topLeftScreenCoordinate.y + m_gopherTrainPosition - GetTileSize() * 3,
+                         48.0f, 48.0f}, // Properly scaled to 48x48 (16 * 3)
+                     WHITE);
 
-        int timerWidth = static_cast<int>((16 * GetTileSize() - 60) *
-                                          (static_cast<float>(m_waveTimer) / WAVE_DURATION));
-        timerWidth = std::min(timerWidth, 16 * GetTileSize() - 60);
+        // Draw train base
+        Rectangle trainBaseRect = {272, 80, 32, 32};
+        list.AddQuad(trainBaseRect,
+                     Rectangle{
+                         m_topLeftScreenCoordinate.x + m_playerPosition.x - GetTileSize() / 2.0f,
+                         m_topLeftScreenCoordinate.y + m_gopherTrainPosition - GetTileSize(),
+                         96.0f, 96.0f}, // Properly scaled to 96x96 (32 * 3)
+                     WHITE);
 
-        DrawRectangle(
-            static_cast<int>(m_topLeftScreenCoordinate.x + 30),
-            static_cast<int>(m_topLeftScreenCoordinate.y - GetTileSize() / 2 + 3),
-            timerWidth,
-            GetTileSize() / 4,
-            timerColor);
-    }
-    else if (!m_shootoutLevel)
-    {
-        if (m_died)
+        // Draw player on train
+        if (m_holdItemTimer > 0)
         {
-            Color timerColor = (m_waveTimer < 8000) ? Color{188, 51, 74, 255} : Color{147, 177, 38, 255};
-
-            int timerWidth = static_cast<int>((16 * GetTileSize() - 60) *
-                                              (static_cast<float>(m_waveTimer) / WAVE_DURATION));
-            timerWidth = std::min(timerWidth, 16 * GetTileSize() - 60);
+            // Player holding item
+            Rectangle playerRect = {256, 112, 16, 16};
+            list.AddQuad(playerRect,
+                         Rectangle{
+                             m_topLeftScreenCoordinate.x + m_playerPosition.x,
+                             m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() / 4.0f,
+                             48.0f, 48.0f}, // Properly scaled to 48x48 (16 * 3)
+                         WHITE);
 
-            DrawRectangle(
-                static_cast<int>(m_topLeftScreenCoordinate.x + 30),
-                static_cast<int>(m_topLeftScreenCoordinate.y - GetTileSize() / 2 + 3),
-                timerWidth,
-                GetTileSize() / 4,
-                timerColor);
+            // Draw held item
+            Rectangle itemRect = {192 + m_itemToHold * 16, 128, 16, 16};
+            list.AddQuad(itemRect,
+                         Rectangle{
+                             m_topLeftScreenCoordinate.x + m_playerPosition.x,
+                             m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() * 2 / 3 - GetTileSize() / 4.0f,
+                             48.0f, 48.0f}, // Properly scaled to 48x48 (16 * 3)
+                         WHITE);
         }
         else
         {
-            // Not in active wave state - show full timer bar
-            DrawRectangle(
-                static_cast<int>(m_topLeftScreenCoordinate.x + 30),
-                static_cast<int>(m_topLeftScreenCoordinate.y - GetTileSize() / 2 + 3),
-                16 * GetTileSize() - 60, // Full width
-                GetTileSize() / 4,
-                Color{147, 177, 38, 255}); // Green color (same as when timer > 8000)
+            // Regular player sprite
+            Rectangle playerRect = {336, 112, 16, 16};
+            list.AddQuad(playerRect,
+                         Rectangle{
+                             m_topLeftScreenCoordinate.x + m_playerPosition.x,
+                             m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() / 4.0f,
+                             48.0f, 48.0f}, // Properly scaled to 48x48 (16 * 3)
+                         WHITE);
         }
-    }
 
-    // Draw powerup indicators
-    if (m_bulletDamage > 1)
-    {
-        DrawTexturePro(
-            GetTexture("cursors"),
-            Rectangle{288.0f + (m_ammoLevel - 1) * 16.0f, 128.0f, 16.0f, 16.0f},
-            Rectangle{m_topLeftScreenCoordinate.x - GetTileSize() - 3,
-                      m_topLeftScreenCoordinate.y + 16 * GetTileSize() - GetTileSize(),
-                      48.0f, 48.0f},
-            Vector2{0, 0},
-            0.0f,
-            WHITE);
+        return false;
     }
 
-    if (m_fireSpeedLevel > 0)
-    {
-        DrawTexturePro(
-            GetTexture("cursors"),
-            Rectangle{192.0f + (m_fireSpeedLevel - 1) * 16.0f, 128.0f, 16.0f, 16.0f},
-            Rectangle{m_topLeftScreenCoordinate.x - GetTileSize() - 3,
-                      m_topLeftScreenCoordinate.y + 16 * GetTileSize() - GetTileSize() * 2,
-                      48.0f, 48.0f},
-            Vector2{0, 0},
-            0.0f,
-            WHITE);
-    }
+    return true;
+}
 
-    if (m_runSpeedLevel > 0)
+bool PrairieKing::IsInstancedParticle(const TemporaryAnimatedSprite &sprite)
+{
+    return sprite.layerDepth >= EFFECT_DEPTH && sprite.rotation == 0.0f && !sprite.flipped &&
+           sprite.tint.r == 255 && sprite.tint.g == 255 && sprite.tint.b == 255 && sprite.tint.a == 255;
+}
+
+void PrairieKing::DrawBullets(DrawList &list)
+{
+    list.BeginInstances(Rectangle{390.0f, 112.0f + (m_bulletDamage - 1) * 4.0f, 4.0f, 4.0f}, Vector2{12.0f, 12.0f});
+    for (const auto &bullet : m_bullets)
     {
-        DrawTexturePro(
-            GetTexture("cursors"),
-            Rectangle{240.0f + (m_runSpeedLevel - 1) * 16.0f, 128.0f, 16.0f, 16.0f},
-            Rectangle{m_topLeftScreenCoordinate.x - GetTileSize() - 3,
-                      m_topLeftScreenCoordinate.y + 16 * GetTileSize() - GetTileSize() * 3,
-                      48.0f, 48.0f},
-            Vector2{0, 0},
-            0.0f,
-            WHITE);
+        list.AddInstance(Vector2{m_topLeftScreenCoordinate.x + bullet.position.x,
+                                 m_topLeftScreenCoordinate.y + bullet.position.y});
     }
 
-    if (m_spreadPistol)
+    list.BeginInstances(Rectangle{395.0f, 112.0f, 5.0f, 5.0f}, Vector2{15.0f, 15.0f});
+    for (size_t i = 0; i < m_enemyBullets.Size(); i++)
     {
-        DrawTexturePro(
-            GetTexture("cursors"),
-            Rectangle{336.0f, 128.0f, 16.0f, 16.0f},
-            Rectangle{m_topLeftScreenCoordinate.x - GetTileSize() - 3,
-                      m_topLeftScreenCoordinate.y + 16 * GetTileSize() - GetTileSize() * 4,
-                      48.0f, 48.0f},
-            Vector2{0, 0},
-            0.0f,
-            WHITE);
+        Vector2 bulletPosition = m_enemyBullets.GetPosition(i);
+        list.AddInstance(Vector2{m_topLeftScreenCoordinate.x + bulletPosition.x,
+                                 m_topLeftScreenCoordinate.y + bulletPosition.y});
     }
+}
 
-    // Draw control instructions at beginning of game
-
-    if (m_betweenWaveTimer > 0 && m_whichWave == 0 && !m_scrollingMap)
+// Top layer effects (explosions, teleports, death puffs), one instanced call for every
+// group that shares a sprite strip and scale
+void PrairieKing::DrawParticles(DrawList &list)
+{
+    auto sameStrip = [](const TemporaryAnimatedSprite &a, const TemporaryAnimatedSprite &b)
     {
-        Vector2 pos = {GetScreenWidth() / 2.6, GetScreenHeight() - 138 - 3};
-        Vector2 pos2 = {GetScreenWidth() / 1.89, GetScreenHeight() - 138 - 3};
-        Vector2 pos3 = {GetScreenWidth() / 1.89, GetScreenHeight() - 81 - 3};
-
-        // Drawing controls instruction box
-
-        DrawTexturePro(
-            GetTexture("cursors"),
-            Rectangle{224, 0, 80, 48},
-            Rectangle{pos.x, pos.y, 240, 144},
-            Vector2{0, 0},
-            0.0f,
-            WHITE);
-
-        // Drawing pause instruction box
-
-        DrawTexturePro(
-            GetTexture("cursors"),
-            Rectangle{119, 0, 41, 17},
-            Rectangle{pos2.x, pos2.y, 150, 54},
-            Vector2{0, 0},
-            0.0f,
-            WHITE);
-
-        // Drawing debug instruction box
+        return a.sourceRect.x == b.sourceRect.x && a.sourceRect.y == b.sourceRect.y &&
+               a.sourceRect.width == b.sourceRect.width && a.sourceRect.height == b.sourceRect.height &&
+               a.scale == b.scale;
+    };
 
-        DrawTexturePro(
-            GetTexture("cursors"),
-            Rectangle{74, 0, 45, 19},
-            Rectangle{pos3.x, pos3.y, 151, 55},
-            Vector2{0, 0},
-            0.0f,
-            WHITE);
+    // Only a handful of different effects are alive at once, so a linear scan over the
+    // strips seen so far is enough to group them
+    std::vector<const TemporaryAnimatedSprite *> strips;
+    for (const auto &sprite : m_temporarySprites)
+    {
+        if (!IsInstancedParticle(sprite) || sprite.delayBeforeAnimationStart > 0)
+        {
+            continue;
+        }
+        auto seen = std::find_if(strips.begin(), strips.end(), [&](const TemporaryAnimatedSprite *strip)
+                                 { return sameStrip(*strip, sprite); });
+        if (seen == strips.end())
+        {
+            strips.push_back(&sprite);
+        }
     }
 
-    // Draw screen flash effect if active
-    if (m_screenFlash > 0)
+    for (const TemporaryAnimatedSprite *strip : strips)
     {
-        DrawRectangle(
-            static_cast<int>(m_topLeftScreenCoordinate.x),
-            static_cast<int>(m_topLeftScreenCoordinate.y),
-            16 * GetTileSize(),
-            16 * GetTileSize(),
-            ColorAlpha(RAYWHITE, static_cast<float>(m_screenFlash) / 1000.0f));
+        list.BeginInstances(strip->sourceRect,
+                            Vector2{strip->sourceRect.width * strip->scale, strip->sourceRect.height * strip->scale});
+        for (const auto &sprite : m_temporarySprites)
+        {
+            if (IsInstancedParticle(sprite) && sprite.delayBeforeAnimationStart <= 0 && sameStrip(sprite, *strip))
+            {
+                list.AddInstance(sprite.position, sprite.currentFrame);
+            }
+        }
     }
+}
 
-    if (m_waitingForPlayerToMoveDownAMap && (m_merchantShopOpen || m_merchantLeaving || !m_shopping) && m_shoppingTimer < 250)
+void PrairieKing::DrawEndCutscene(DrawList &list)
+{
+    switch (m_endCutscenePhase)
     {
-        // Draw the arrow at the bottom of the screen
-        DrawTexturePro(
-            GetTexture("cursors"),
-            Rectangle{227.0f, 102.0f, 8.0f, 8.0f},
-            Rectangle{m_topLeftScreenCoordinate.x + 8.5f * GetTileSize() - 12,
-                      m_topLeftScreenCoordinate.y + 15.0f * GetTileSize(),
-                      24.0f, 24.0f},
-            Vector2{0, 0},
-            0.0f,
-            WHITE);
-    }
+    case 0:
+        // Phase 0: Player holding heart with black background
+        list.AddRectangle(0, 0, m_screenWidth, m_screenHeight, BLACK);
+
+        // Draw player holding heart
+        list.AddQuad(
+            Rectangle{256.0f, 112.0f, 16.0f, 16.0f},
+            Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
+                      m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() / 4.0f,
+                      48.0f, 48.0f},
+            (m_endCutsceneTimer < 2000) ? ColorAlpha(WHITE, 1.0f * (static_cast<float>(m_endCutsceneTimer) / 2000.0f)) : WHITE);
 
-    DrawDebugInfo();
+        // Draw the heart above player
+        list.AddQuad(
+            Rectangle{192.0f + m_itemToHold * 16.0f, 128.0f, 16.0f, 16.0f},
+            Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
+                      m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() * 2.0f / 3.0f - GetTileSize() / 4.0f,
+                      48.0f, 48.0f},
+            (m_endCutsceneTimer < 2000) ? ColorAlpha(WHITE, 1.0f * (static_cast<float>(m_endCutsceneTimer) / 2000.0f)) : WHITE);
+        break;
 
-    // Draw pause overlay if paused
-    if (m_isPaused)
-    {
-        // Draw semi-transparent overlay
-        DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), 
-                     ColorAlpha(BLACK, 0.7f));
-        
-        float centerX = GetScreenWidth() / 2.0f;
-        float centerY = GetScreenHeight() / 2.0f;
-        
-        // Draw "PAUSED" text
-        const char *pausedText = "PAUSED";
-        Vector2 pausedSize = MeasureTextEx(m_assets.GetFont("title"), pausedText, 48, 1);
-        DrawTextEx(m_assets.GetFont("title"), pausedText,
-                   Vector2{centerX - pausedSize.x/2, centerY - 100},
-                   48, 1, WHITE);
-        
-        if (!m_showPauseSettings)
+    case 1:
+    case 2:
+    case 3:
+        // Draw the final map
+        list.AddTileLayer(DrawList::MAP_LAYER,
+                          Vector2{m_topLeftScreenCoordinate.x,
+                                  m_topLeftScreenCoordinate.y + m_newMapPosition - 16 * GetTileSize()},
+                          static_cast<float>(PIXEL_ZOOM), (m_cactusDanceTimer > 800.0f) ? 1 : 0);
+
+        // Draw the cowboy statue/monument
+        list.AddQuad(
+            Rectangle{160.0f, 49.0f, 64.0f, 80.0f},
+            Rectangle{m_topLeftScreenCoordinate.x + 6.0f * GetTileSize(),
+                      m_topLeftScreenCoordinate.y + 3.0f * GetTileSize(),
+                      192.0f, 240.0f}, WHITE);
+
+        if (m_endCutscenePhase == 3)
         {
-            // Draw pause menu options
-            const char *options[] = {"Resume", "Settings", "Back to Main Menu"};
-            
-            for (int i = 0; i < 3; i++)
+            // Draw kiss
+            list.AddQuad(
+                Rectangle{416.0f, 144.0f, 32.0f, 32.0f},
+                Rectangle{m_topLeftScreenCoordinate.x + 9.0f * GetTileSize(),
+                          m_topLeftScreenCoordinate.y + 7.0f * GetTileSize(),
+                          96.0f, 96.0f}, WHITE);
+
+            if (m_endCutsceneTimer < 3000)
             {
-                const char *optionText = TextFormat("%s%s", 
-                    m_pauseOption == i ? "> " : "  ", options[i]);
-                
-                Vector2 optionPos = {
-                    centerX - 100,
-                    centerY + (i * 40.0f)
-                };
-                
-                DrawTextEx(m_assets.GetFont("text"), optionText,
-                           optionPos, 32, 1, WHITE);
+                // Fade to black
+                float alpha = 1.0f - (static_cast<float>(m_endCutsceneTimer) / 3000.0f);
+                list.AddRectangle(0, 0, m_screenWidth, m_screenHeight, ColorAlpha(BLACK, alpha));
             }
         }
         else
         {
-            // Draw settings menu (simplified version)
-            DrawTextEx(m_assets.GetFont("text"), "Settings (Press ESC to go back)",
-                       Vector2{centerX - 150, centerY},
-                       24, 1, WHITE);
-            
-            if (IsKeyPressed(GameKeys::Exit))
-            {
-                m_showPauseSettings = false;
+            // Draw singing wife
+            int heartFrame = static_cast<int>(-m_endCutsceneTimer / 300) % 4;
+            list.AddQuad(
+                Rectangle{96.0f - heartFrame * 16.0f, 144.0f, 16.0f, 16.0f},
+                Rectangle{m_topLeftScreenCoordinate.x + 10.0f * GetTileSize(),
+                          m_topLeftScreenCoordinate.y + 8.0f * GetTileSize(),
+                          48.0f, 48.0f}, WHITE);
+
+            if (m_endCutscenePhase == 2)
+            {
+                // Draw walking player
+                list.AddQuad(
+                    Rectangle{356.0f, 112.0f + static_cast<int>(m_playerMotionAnimationTimer / 100.0f) * 3.0f, 8.0f, 3.0f},
+                    Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x + 4.0f * 3.0f,
+                              m_topLeftScreenCoordinate.y + m_playerPosition.y + 13.0f * 3.0f,
+                              24.0f, 9.0f}, WHITE);
+
+                list.AddQuad(
+                    Rectangle{256.0f, 112.0f, 16.0f, 13.0f},
+                    Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
+                              m_topLeftScreenCoordinate.y + m_playerPosition.y,
+                              48.0f, 39.0f}, WHITE);
+
+                // Draw held item
+                list.AddQuad(
+                    Rectangle{192.0f + m_itemToHold * 16.0f, 128.0f, 16.0f, 16.0f},
+                    Rectangle{m_topLeftScreenCoordinate.x + m_playerPosition.x,
+                              m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() * 2.0f / 3.0f - GetTileSize() / 4.0f,
+                              48.0f, 48.0f}, WHITE);
             }
         }
-        
-        return; // Don't draw game elements when paused
-    }
 
-    // Add to PrairieKing::Draw() method
-    if (m_gopherTrain && m_gopherTrainPosition > -GetTileSize())
-    {
-        DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), BLACK);
+        break;
 
-        // Draw gopher train cars
-        Rectangle gopherCarRect = {256 + (m_gopherTrainPosition / 30 % 4) * 16, 144, 16, 16};
+    case 4:
+    case 5:
+        // Victory screen with "THE END" message and menu
+        {
+            // Draw black background
+            list.AddRectangle(0, 0, m_screenWidth, m_screenHeight, BLACK);
 
-        DrawTexturePro(GetTexture("cursors"),
-                       gopherCarRect,
-                       Rectangle{
-                           m_topLeftScreenCoordinate.x + m_playerPosition.x - GetTileSize() / 2.0f,
-                           m_topLeftScreenCoordinate.y + m_gopherTrainPosition,
-                           48.0f, 48.0f}, // Properly scaled to 48x48 (16 * 3)
-                       Vector2{0, 0}, 0.0f, WHITE);
-
-        DrawTexturePro(GetTexture("cursors"),
-                       gopherCarRect,
-                       Rectangle{
-                           m_topLeftScreenCoordinate.x + m_playerPosition.x + GetTileSize() / 2.0f,
-                           m_topLeftScreenCoordinate.y + m_gopherTrainPosition,
-                           48.0f, 48.0f}, // Properly scaled to 48x48 (16 * 3)
-                       Vector2{0, 0}, 0.0f, WHITE);
+            // Calculate screen center
+            float centerX = m_screenWidth / 2.0f;
+            float centerY = m_screenHeight / 2.0f;
 
-        // Draw gopher engine
-        Rectangle gopherEngineRect = {192 + (m_gopherTrainPosition / 30 % 4) * 16, 144, 16, 16};
-        DrawTexturePro(GetTexture("cursors"),
-                       gopherEngineRect,
-                       Rectangle{
-                           m_topLeftScreenCoordinate.x + m_playerPosition.x,
-                           m_topLeftScreenCoordinate.y + m_gopherTrainPosition - GetTileSize() * 3,
-                           48.0f, 48.0f}, // Properly scaled to 48x48 (16 * 3)
-                       Vector2{0, 0}, 0.0f, WHITE);
+            // Calculate THE END logo scale based on screen size (made bigger)
+            float baseWidth = 64.0f;                      // Original sprite width
+            float baseHeight = 48.0f;                     // Original sprite height
+            float targetWidth = m_screenWidth * 0.30f;    // Increased from 15% to 20% of screen width
+            float scale = targetWidth / baseWidth;
 
-        // Draw train base
-        Rectangle trainBaseRect = {272, 80, 32, 32};
-        DrawTexturePro(GetTexture("cursors"),
-                       trainBaseRect,
-                       Rectangle{
-                           m_topLeftScreenCoordinate.x + m_playerPosition.x - GetTileSize() / 2.0f,
-                           m_topLeftScreenCoordinate.y + m_gopherTrainPosition - GetTileSize(),
-                           96.0f, 96.0f}, // Properly scaled to 96x96 (32 * 3)
-                       Vector2{0, 0}, 0.0f, WHITE);
+            // Draw THE END logo - moved higher up for better spacing
+            list.AddQuad(
+                Rectangle{96.0f, 96.0f, baseWidth, baseHeight},
+                Rectangle{
+                    centerX - (baseWidth * scale) / 2.0f,
+                    centerY - (baseHeight * scale) / 2.0f - 150.0f, // Moved up from -50 to -120
+                    baseWidth * scale,
+                    baseHeight * scale},
+                (m_endCutsceneTimer > 0) ? ColorAlpha(WHITE, 1.0f - (static_cast<float>(m_endCutsceneTimer) / 1000.0f))
+                                         : WHITE);
 
-        // Draw player on train
-        if (m_holdItemTimer > 0)
-        {
-            // Player holding item
-            Rectangle playerRect = {256, 112, 16, 16};
-            DrawTexturePro(GetTexture("cursors"), playerRect,
-                           Rectangle{
-                               m_topLeftScreenCoordinate.x + m_playerPosition.x,
-                               m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() / 4.0f,
-                               48.0f, 48.0f}, // Properly scaled to 48x48 (16 * 3)
-                           Vector2{0, 0}, 0.0f, WHITE);
+            if (m_endCutscenePhase == 5)
+            {
+                const char *options[END_MENU_OPTIONS] = {
+                    "Continue to New Game+",
+                    "Back to Main Menu",
+                    "Quit Game"};
 
-            // Draw held item
-            Rectangle itemRect = {192 + m_itemToHold * 16, 128, 16, 16};
-            DrawTexturePro(GetTexture("cursors"), itemRect,
-                           Rectangle{
-                               m_topLeftScreenCoordinate.x + m_playerPosition.x,
-                               m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() * 2 / 3 - GetTileSize() / 4.0f,
-                               48.0f, 48.0f}, // Properly scaled to 48x48 (16 * 3)
-                           Vector2{0, 0}, 0.0f, WHITE);
+                for (int i = 0; i < END_MENU_OPTIONS; i++)
+                {
+                    // Clicks are handled in UpdateEndMenu; here the pointer only picks the highlight
+                    Rectangle buttonRect = GetEndMenuButton(i);
+                    bool isHovered = CheckCollisionPointRec(m_pointer, buttonRect);
+                    Color buttonColor = isHovered ? RED : WHITE;
+
+                    // Draw button background with semi-transparency
+                    list.AddRectangle(buttonRect, ColorAlpha(BLACK, isHovered ? 0.8f : 0.6f));
+
+                    // Draw button border
+                    list.AddRectangleLines(buttonRect, 2, buttonColor);
+
+                    // Calculate text position to center it in button
+                    const TextRun &optionRun = m_textCache.Get(m_assets.GetFont(FontId::Text), options[i], 28, 1); // Increased font size
+                    Vector2 textSize = optionRun.GetSize();
+                    Vector2 textPos = {
+                        buttonRect.x + (buttonRect.width - textSize.x) / 2.0f,
+                        buttonRect.y + (buttonRect.height - textSize.y) / 2.0f};
+
+                    // Draw button text
+                    list.AddText(optionRun, textPos, buttonColor);
+                }
+            }
         }
-        else
+        break;
+    }
+}
+
+Rectangle PrairieKing::GetEndMenuButton(int index) const
+{
+    // Calculate menu positioning with better spacing
+    const float centerX = m_screenWidth / 2.0f;
+    const float menuStartY = m_screenHeight / 2.0f + m_screenHeight / 4.0f; // Moved closer to center
+    const float buttonHeight = 60.0f;                                       // Increased button height
+    const float buttonSpacing = 30.0f;                                      // Increased spacing between buttons
+    const float buttonWidth = 350.0f;                                       // Increased button width
+
+    return Rectangle{
+        centerX - buttonWidth / 2.0f,
+        menuStartY + (buttonHeight + buttonSpacing) * index,
+        buttonWidth,
+        buttonHeight};
+}
+
+void PrairieKing::UpdateEndMenu()
+{
+    if (!m_pointerPressed)
+    {
+        return;
+    }
+
+    for (int i = 0; i < END_MENU_OPTIONS; i++)
+    {
+        if (!CheckCollisionPointRec(m_pointer, GetEndMenuButton(i)))
         {
-            // Regular player sprite
-            Rectangle playerRect = {336, 112, 16, 16};
-            DrawTexturePro(GetTexture("cursors"), playerRect,
-                           Rectangle{
-                               m_topLeftScreenCoordinate.x + m_playerPosition.x,
-                               m_topLeftScreenCoordinate.y + m_playerPosition.y - GetTileSize() / 4.0f,
-                               48.0f, 48.0f}, // Properly scaled to 48x48 (16 * 3)
-                           Vector2{0, 0}, 0.0f, WHITE);
+            continue;
+        }
+
+        switch (i)
+        {
+        case 0: // Continue to New Game+
+            m_whichRound++;
+            StartNewRound();
+            m_endCutscene = false;
+            m_endCutscenePhase = 0;
+            break;
+
+        case 1: // Back to Main Menu
+            // Set flag to return to main menu instead of setting m_isGameOver
+            m_shouldReturnToMenu = true;
+            m_endCutscene = false;
+            m_endCutscenePhase = 0;
+            break;
+
+        case 2: // Quit Game
+            m_closeRequested = true;
+            break;
         }
+        return;
     }
 }
 
@@ -3995,20 +4212,94 @@ Rectangle PrairieKing::GetRectForShopItem(int itemID)
     }
 }
 
-Texture2D PrairieKing::GetTexture(const std::string &name)
+void PrairieKing::ClearStoreItems()
+{
+    m_storeItemCount = 0;
+    memset(m_storeHitGrid, 0, sizeof(m_storeHitGrid));
+}
+
+void PrairieKing::AddStoreItem(const Rectangle &bounds, int item)
+{
+    if (m_storeItemCount >= MAX_STORE_ITEMS)
+    {
+        return;
+    }
+
+    int slot = m_storeItemCount++;
+    m_storeItems[slot] = {bounds, item};
+
+    // Mark every tile the item overlaps so purchases only test nearby slots
+    int minX = std::max(0, static_cast<int>(bounds.x) / GetTileSize());
+    int minY = std::max(0, static_cast<int>(bounds.y) / GetTileSize());
+    int maxX = std::min(MAP_WIDTH - 1, static_cast<int>(bounds.x + bounds.width - 1) / GetTileSize());
+    int maxY = std::min(MAP_HEIGHT - 1, static_cast<int>(bounds.y + bounds.height - 1) / GetTileSize());
+
+    for (int x = minX; x <= maxX; x++)
+    {
+        for (int y = minY; y <= maxY; y++)
+        {
+            m_storeHitGrid[x][y] |= static_cast<uint16_t>(1u << slot);
+        }
+    }
+}
+
+void PrairieKing::RemoveStoreItem(int slot)
 {
-    return m_assets.GetTexture(name);
+    if (slot < 0 || slot >= m_storeItemCount)
+    {
+        return;
+    }
+
+    // Keep the remaining slots in order and rebuild the hit grid from them
+    StoreItem remaining[MAX_STORE_ITEMS];
+    int remainingCount = 0;
+    for (int i = 0; i < m_storeItemCount; i++)
+    {
+        if (i != slot)
+        {
+            remaining[remainingCount++] = m_storeItems[i];
+        }
+    }
+
+    ClearStoreItems();
+    for (int i = 0; i < remainingCount; i++)
+    {
+        AddStoreItem(remaining[i].bounds, remaining[i].item);
+    }
 }
 
-Sound PrairieKing::GetSound(const std::string &name)
+int PrairieKing::GetStoreItemAt(const Rectangle &box) const
 {
-    return m_assets.GetSound(name);
+    int minX = std::max(0, static_cast<int>(box.x) / GetTileSize());
+    int minY = std::max(0, static_cast<int>(box.y) / GetTileSize());
+    int maxX = std::min(MAP_WIDTH - 1, static_cast<int>(box.x + box.width) / GetTileSize());
+    int maxY = std::min(MAP_HEIGHT - 1, static_cast<int>(box.y + box.height) / GetTileSize());
+
+    uint16_t candidates = 0;
+    for (int x = minX; x <= maxX; x++)
+    {
+        for (int y = minY; y <= maxY; y++)
+        {
+            candidates |= m_storeHitGrid[x][y];
+        }
+    }
+
+    // Lowest slot wins so overlapping items resolve the same way every time
+    for (int slot = 0; slot < m_storeItemCount; slot++)
+    {
+        if ((candidates & (1u << slot)) && CheckCollisionRecs(box, m_storeItems[slot].bounds))
+        {
+            return slot;
+        }
+    }
+
+    return -1;
 }
 
-Sound PrairieKing::GetSoundStatic(const std::string &name)
+const Sound &PrairieKing::GetSoundStatic(SoundId id)
 {
-    // Simple implementation for static context
-    return LoadSound(name.c_str());
+    // Same handles as GetSound, for code that runs without an instance pointer at hand
+    return s_instance->m_assets.GetSound(id);
 }
 
 PrairieKing::JOTPKProgress PrairieKing::GetProgress() const
@@ -4034,21 +4325,72 @@ PrairieKing::JOTPKProgress PrairieKing::GetProgress() const
 void PrairieKing::AddMonster(CowboyMonster *monster)
 {
     if (!IsCollidingWithMonster(monster->position, nullptr) &&
-        !IsCollidingWithMapForMonsters(monster->position))
+        !IsCollidingWithMap(monster->position, LAYER_WALKER))
     {
         if (m_whichRound > 0)
         {
             monster->health += m_whichRound * 2;
         }
 
-        m_monsters.push_back(monster);
-        PlaySound(GetSound("cowboy_monsterhit"));
+        PushMonster(monster);
+        PlaySound(GetSound(SoundId::CowboyMonsterHit));
     }
     else
     {
         delete monster;
     }
 }
+
+void PrairieKing::PushBullet(const CowboyBullet &bullet)
+{
+    m_bullets.push_back(bullet);
+}
+
+void PrairieKing::PushMonster(CowboyMonster *monster)
+{
+    monster->spawnOrder = m_nextMonsterSpawnOrder++;
+    m_monsters.push_back(monster);
+    m_monsterGrid.Insert(monster, monster->position, monster->gridCell);
+}
+
+void PrairieKing::RemoveMonster(int index)
+{
+    CowboyMonster *monster = m_monsters[index];
+    m_monsterGrid.Remove(monster, monster->gridCell);
+    delete monster;
+    m_monsters.erase(m_monsters.begin() + index);
+}
+
+void PrairieKing::RemoveMonster(CowboyMonster *monster)
+{
+    // During the Move loop indices into m_monsters have to stay put: take it off the grid
+    // now so nothing collides with it anymore, and let Update drop it once the loop is done
+    if (m_movingMonsters)
+    {
+        if (!monster->removed)
+        {
+            m_monsterGrid.Remove(monster, monster->gridCell);
+            monster->removed = true;
+            m_removedWhileMoving.push_back(monster);
+        }
+        return;
+    }
+
+    auto it = std::find(m_monsters.begin(), m_monsters.end(), monster);
+    if (it != m_monsters.end())
+    {
+        RemoveMonster(static_cast<int>(it - m_monsters.begin()));
+    }
+}
+
+void PrairieKing::RebuildMonsterGrid()
+{
+    m_monsterGrid.Clear();
+    for (auto monster : m_monsters)
+    {
+        m_monsterGrid.Insert(monster, monster->position, monster->gridCell);
+    }
+}
 void PrairieKing::AddTemporarySprite(const TemporaryAnimatedSprite &sprite)
 {
     m_temporarySprites.push_back(sprite);
@@ -4073,6 +4415,7 @@ void PrairieKing::StartNewWave()
         delete monster;
     }
     m_monsters.clear();
+    m_monsterGrid.Clear();
 
     // Update monster chances
     UpdateMonsterChancesForWave();
@@ -4089,9 +4432,9 @@ void PrairieKing::StartNewWave()
         else
         {
             m_waitingForPlayerToMoveDownAMap = true;
-            m_map[8][15] = MAP_DESERT;
-            m_map[7][15] = MAP_DESERT;
-            m_map[9][15] = MAP_DESERT;
+            SetMapTile(8, 15, MAP_DESERT);
+            SetMapTile(7, 15, MAP_DESERT);
+            SetMapTile(9, 15, MAP_DESERT);
         }
     }
 
@@ -4205,14 +4548,14 @@ void PrairieKing::UpdatePlayer(float deltaTime)
     }
 
     // Recolectar power-ups si el jugador está sobre ellos
-    for (int i = m_powerups.size() - 1; i >= 0; i--)
+    bool insideNoPickUpBox = CheckCollisionRecs(m_playerBoundingBox, m_noPickUpBox);
+    if (!insideNoPickUpBox)
     {
-        if (CheckCollisionRecs(
-                m_playerBoundingBox,
-                Rectangle{m_powerups[i].position.x, m_powerups[i].position.y,
-                          static_cast<float>(GetTileSize()), static_cast<float>(GetTileSize())}) &&
-            !CheckCollisionRecs(m_playerBoundingBox, m_noPickUpBox))
+        int touched[MAX_QUERY_RESULTS];
+        int touchedCount = QueryPowerupsInRect(m_playerBoundingBox, touched, MAX_QUERY_RESULTS);
+        for (int n = 0; n < touchedCount; n++)
         {
+            int i = touched[n];
             if (m_heldItem != nullptr)
             {
                 UsePowerup(m_powerups[i].which);
@@ -4226,7 +4569,7 @@ void PrairieKing::UpdatePlayer(float deltaTime)
     }
 
     // Limpiar la caja de no recoger si el jugador no está colisionando con ella
-    if (!CheckCollisionRecs(m_playerBoundingBox, m_noPickUpBox))
+    if (!insideNoPickUpBox)
     {
         m_noPickUpBox = {0.0f, 0.0f, static_cast<float>(GetTileSize()), static_cast<float>(GetTileSize())};
     }
@@ -4326,7 +4669,7 @@ void PrairieKing::UpdatePlayer(float deltaTime)
             m_playerFootstepSoundTimer -= deltaTime * 1000.0f;
             if (m_playerFootstepSoundTimer <= 0.0f)
             {
-                PlaySound(GetSound("cowboy_footstep"));
+                PlaySound(GetSound(SoundId::CowboyFootstep));
                 m_playerFootstepSoundTimer = 200.0f;
             }
         }
@@ -4356,14 +4699,19 @@ void PrairieKing::UpdatePlayer(float deltaTime)
     }
 
     // Verificar colisiones con monstruos
-    for (int i = m_monsters.size() - 1; i >= 0; i--)
+    if (m_playerInvincibleTimer <= 0 && !m_godMode) // God Mode ignora el daño
     {
-        if (CheckCollisionRecs(m_monsters[i]->position, m_playerBoundingBox) && m_playerInvincibleTimer <= 0)
-        {
-            if (m_godMode)
-                continue; // Ignora el daño si God Mode está activo
+        // Newest first, like the old reverse scan over m_monsters. A crowd of more than
+        // MAX_QUERY_RESULTS on the player in zombie mode is finished off over the next ticks
+        CowboyMonster *touching[MAX_QUERY_RESULTS];
+        int touchingCount = QueryMonstersInRect(m_playerBoundingBox, touching, MAX_QUERY_RESULTS);
+        std::sort(touching, touching + touchingCount, [](const CowboyMonster *a, const CowboyMonster *b)
+                  { return a->spawnOrder > b->spawnOrder; });
 
-            if (m_monsters[i]->type == GameConstants::SPIKEY && m_monsters[i]->spikeyIsBlock)
+        for (int i = 0; i < touchingCount; i++)
+        {
+            CowboyMonster *monster = touching[i];
+            if (monster->type == GameConstants::SPIKEY && monster->spikeyIsBlock)
             {
                 PlayerDie();
                 break;
@@ -4375,13 +4723,12 @@ void PrairieKing::UpdatePlayer(float deltaTime)
                 PlayerDie();
                 break;
             }
-            else if (m_monsters[i]->type != -2) // Not a boss
+            else if (monster->type != -2) // Not a boss
             {
                 // Zombie mode - kill the monster!
-                AddGuts(Vector2{m_monsters[i]->position.x, m_monsters[i]->position.y}, m_monsters[i]->type);
-                delete m_monsters[i];
-                m_monsters.erase(m_monsters.begin() + i);
-                PlaySound(GetSound("Cowboy_monsterDie"));
+                AddGuts(Vector2{monster->position.x, monster->position.y}, monster->type);
+                RemoveMonster(monster);
+                PlaySound(GetSound(SoundId::CowboyMonsterDie));
             }
         }
     }
@@ -4445,7 +4792,7 @@ void PrairieKing::UpdatePlayer(float deltaTime)
         }
 
         // Reproducir sonido de disparo
-        PlaySound(GetSound("cowboy_gunshot"));
+        PlaySound(GetSound(SoundId::CowboyGunshot));
 
         // Establecer cooldown de disparo
         m_shotTimer = m_shootingDelay;
@@ -4473,32 +4820,6 @@ void PrairieKing::UpdatePlayer(float deltaTime)
     }
 }
 
-std::vector<Vector2> PrairieKing::GetBorderPoints()
-{
-    std::vector<Vector2> points;
-    const int tileSize = GetTileSize();
-
-    // Add top and bottom border points
-    for (int x = 1; x < MAP_WIDTH - 1; x++)
-    {
-        // Top border
-        points.push_back({static_cast<float>(x * tileSize), 0.0f});
-        // Bottom border
-        points.push_back({static_cast<float>(x * tileSize), static_cast<float>((MAP_HEIGHT - 1) * tileSize)});
-    }
-
-    // Add left and right border points
-    for (int y = 1; y < MAP_HEIGHT - 1; y++)
-    {
-        // Left border
-        points.push_back({0.0f, static_cast<float>(y * tileSize)});
-        // Right border
-        points.push_back({static_cast<float>((MAP_WIDTH - 1) * tileSize), static_cast<float>(y * tileSize)});
-    }
-
-    return points;
-}
-
 // Implementación de los constructores de CowboyMonster
 PrairieKing::CowboyMonster::CowboyMonster(AssetManager &assets, int which, Vector2 position)
     : type(which), position({position.x, position.y, 16.0f * 3, 16.0f * 3})
@@ -4570,7 +4891,7 @@ PrairieKing::CowboyMonster::CowboyMonster(AssetManager &assets, int which, Vecto
     invisible = false;
     special = false;
     uninterested = false;
-    flyer = false;
+    flyer = (GetCollisionLayer() == LAYER_FLYER);
     tint = WHITE;
     flashColor = WHITE;
     flashColorTimer = 0.0f;
@@ -4611,7 +4932,7 @@ PrairieKing::Outlaw::Outlaw(AssetManager &assets, Vector2 position, int health)
 
 // Implementación de los métodos virtuales de CowboyMonster
 // Update the Draw method to handle invisible and special states:
-void PrairieKing::CowboyMonster::Draw(const Texture2D &texture, Vector2 topLeftScreenCoordinate)
+void PrairieKing::CowboyMonster::Draw(DrawList &list, Vector2 topLeftScreenCoordinate)
 {
     // Don't draw if invisible (except spikey which has special handling)
     if (invisible && type != GameConstants::SPIKEY)
@@ -4664,27 +4985,33 @@ void PrairieKing::CowboyMonster::Draw(const Texture2D &texture, Vector2 topLeftS
     }
 
     // Draw the monster
-    DrawTexturePro(texture, sourceRect, destRect, Vector2{0, 0}, 0.0f, WHITE);
+    list.AddSprite(sourceRect, destRect, GetCharacterDepth(position.y));
+}
+
+void PrairieKing::CowboyMonster::DrawOverlay(DrawList &list, Vector2 topLeftScreenCoordinate)
+{
+    if (invisible)
+        return;
 
     // Draw confusion indicator if monster is confused
     if (PrairieKing::GetGameInstance()->m_monsterConfusionTimer > 0)
     {
-        Font smallFont = PrairieKing::GetGameInstance()->m_assets.GetFont("small");
-        const char *text = "?";
-        Vector2 textSize = MeasureTextEx(smallFont, text, 16.0f, 1.0f);
+        PrairieKing *game = PrairieKing::GetGameInstance();
+        const TextRun &text = game->m_textCache.Get(game->m_assets.GetFont(FontId::Small), "?", 16.0f, 1.0f);
+        Vector2 textSize = text.GetSize();
 
         Vector2 textPos = {
             topLeftScreenCoordinate.x + position.x + position.width / 2 - textSize.x / 2,
             topLeftScreenCoordinate.y + position.y - PrairieKing::GetGameInstance()->GetTileSize() / 2};
 
         Color confusionColor = {88, 29, 43, 255};
-        DrawTextEx(smallFont, text, textPos, 16.0f, 1.0f, confusionColor);
+        list.AddText(text, textPos, confusionColor);
     }
 }
 
 bool PrairieKing::CowboyMonster::TakeDamage(int damage)
 {
-    PlaySound(PrairieKing::GetGameInstance()->GetSound("cowboy_monsterhit"));
+    PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyMonsterHit));
 
     if (invisible)
         return false;
@@ -4700,7 +5027,7 @@ bool PrairieKing::CowboyMonster::TakeDamage(int damage)
         if (lootDrop != -1)
         {
             // Add powerup at monster position
-            PrairieKing::GetGameInstance()->m_powerups.push_back(
+            PrairieKing::GetGameInstance()->AddPowerup(
                 CowboyPowerup(lootDrop, Vector2{position.x, position.y}, 10000));
         }
 
@@ -4812,8 +5139,8 @@ bool PrairieKing::CowboyMonster::Move(Vector2 playerPosition, float deltaTime)
     {
         // --- SOLO SPIKEYS PUEDEN ENTRAR EN MODO BLOQUE ---
         // No bloque para otros monstruos
-        // Lógica normal de movimiento para estos monstruos
-        if (ticksSinceLastMovement > 20)
+        // Only wanderers pick random spots; everyone else chases the player down the flow field
+        if (uninterested && ticksSinceLastMovement > 20)
         {
             int tries = 0;
             do
@@ -4832,11 +5159,21 @@ bool PrairieKing::CowboyMonster::Move(Vector2 playerPosition, float deltaTime)
 
         // Determine the target
         Vector2 target = (targetPosition.x != 0.0f || targetPosition.y != 0.0f) ? targetPosition : playerPosition;
+        Vector2 goal = target;
+        bool followingFlowField = false;
 
         // If the gopher is running, chase the gopher instead
-        if (PrairieKing::GetGameInstance()->m_gopherRunning)
+        Vector2 gopherPosition;
+        if (PrairieKing::GetGameInstance()->FindRunningGopher(gopherPosition))
+        {
+            target = gopherPosition;
+            goal = target;
+        }
+        else if (targetPosition.x == 0.0f && targetPosition.y == 0.0f)
         {
-            target = {PrairieKing::GetGameInstance()->m_gopherBox.x, PrairieKing::GetGameInstance()->m_gopherBox.y};
+            // Chasing the player: head for the next tile on the shared flow field
+            target = PrairieKing::GetGameInstance()->GetFlowFieldTarget(position, static_cast<float>(speed));
+            followingFlowField = true;
         }
 
         // Occasionally change movement direction
@@ -4912,35 +5249,56 @@ bool PrairieKing::CowboyMonster::Move(Vector2 playerPosition, float deltaTime)
             attemptedPosition.x = position.x - (attemptedPosition.x - position.x);
             attemptedPosition.y = position.y - (attemptedPosition.y - position.y);
         }
+        else if (followingFlowField)
+        {
+            // Snap onto the row/column we're travelling along so tile corners don't snag us
+            float tileSize = static_cast<float>(PrairieKing::GetGameInstance()->GetTileSize());
+            if (movementDirection == 1 || movementDirection == 3)
+            {
+                float alignedY = roundf(attemptedPosition.y / tileSize) * tileSize;
+                if (fabsf(alignedY - attemptedPosition.y) <= speed)
+                    attemptedPosition.y = alignedY;
+            }
+            else
+            {
+                float alignedX = roundf(attemptedPosition.x / tileSize) * tileSize;
+                if (fabsf(alignedX - attemptedPosition.x) <= speed)
+                    attemptedPosition.x = alignedX;
+            }
+        }
 
         // Special behavior for Ogre (type 2)
         if (type == GameConstants::OGRE)
         {
-            for (int i = PrairieKing::GetGameInstance()->m_monsters.size() - 1; i >= 0; i--)
+            CowboyMonster *crushed[PrairieKing::MAX_QUERY_RESULTS];
+            int crushedCount = PrairieKing::GetGameInstance()->QueryMonstersInRect(
+                attemptedPosition, crushed, PrairieKing::MAX_QUERY_RESULTS, GameConstants::SPIKEY);
+            for (int i = 0; i < crushedCount; i++)
             {
-                auto *monster = PrairieKing::GetGameInstance()->m_monsters[i];
-                if (monster->type == GameConstants::SPIKEY && monster->special &&
-                    CheckCollisionRecs(attemptedPosition, monster->position))
+                auto *monster = crushed[i];
+                if (monster->special)
                 {
                     PrairieKing::AddGuts({monster->position.x, monster->position.y}, monster->type);
-                    PlaySound(PrairieKing::GetGameInstance()->GetSound("Cowboy_monsterDie"));
-                    delete monster;
-                    PrairieKing::GetGameInstance()->m_monsters.erase(
-                        PrairieKing::GetGameInstance()->m_monsters.begin() + i);
+                    PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyMonsterDie));
+                    PrairieKing::GetGameInstance()->RemoveMonster(monster);
                 }
             }
         }
 
         // Check for collisions
-        if (PrairieKing::GetGameInstance()->IsCollidingWithMapForMonsters(attemptedPosition) ||
+        if (PrairieKing::GetGameInstance()->IsCollidingWithMap(attemptedPosition, LAYER_WALKER) ||
             PrairieKing::GetGameInstance()->IsCollidingWithMonster(attemptedPosition, this) ||
             PrairieKing::GetGameInstance()->m_deathTimer > 0.0f)
         {
-            // Si el monstruo está atascado, elige un nuevo target aleatorio
+            // Un errante atascado elige otro destino; los que persiguen siguen el campo de flujo
+            // y, como no se movieron, prueban otra dirección en el siguiente tick
             ticksSinceLastMovement = 0;
-            targetPosition = {
-                static_cast<float>(GetRandomInt(2, 14) * PrairieKing::GetGameInstance()->GetTileSize()),
-                static_cast<float>(GetRandomInt(2, 14) * PrairieKing::GetGameInstance()->GetTileSize())};
+            if (uninterested)
+            {
+                targetPosition = {
+                    static_cast<float>(GetRandomInt(2, 14) * PrairieKing::GetGameInstance()->GetTileSize()),
+                    static_cast<float>(GetRandomInt(2, 14) * PrairieKing::GetGameInstance()->GetTileSize())};
+            }
             break;
         }
 
@@ -4950,8 +5308,8 @@ bool PrairieKing::CowboyMonster::Move(Vector2 playerPosition, float deltaTime)
         movedLastTurn = true;
 
         // Check if we reached the target
-        if (!CheckCollisionPointRec({target.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
-                                     target.y + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
+        if (!CheckCollisionPointRec({goal.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
+                                     goal.y + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
                                     position))
         {
             break;
@@ -5000,9 +5358,10 @@ bool PrairieKing::CowboyMonster::Move(Vector2 playerPosition, float deltaTime)
         Vector2 target = (targetPosition.x != 0.0f || targetPosition.y != 0.0f) ? targetPosition : playerPosition;
 
         // If the gopher is running, chase the gopher instead
-        if (PrairieKing::GetGameInstance()->m_gopherRunning)
+        Vector2 gopherPosition;
+        if (PrairieKing::GetGameInstance()->FindRunningGopher(gopherPosition))
         {
-            target = {PrairieKing::GetGameInstance()->m_gopherBox.x, PrairieKing::GetGameInstance()->m_gopherBox.y};
+            target = gopherPosition;
         }
 
         // Occasionally change movement direction
@@ -5080,7 +5439,7 @@ bool PrairieKing::CowboyMonster::Move(Vector2 playerPosition, float deltaTime)
         }
 
         // Check for collisions
-        if (PrairieKing::GetGameInstance()->IsCollidingWithMapForMonsters(attemptedPosition) ||
+        if (PrairieKing::GetGameInstance()->IsCollidingWithMap(attemptedPosition, LAYER_WALKER) ||
             PrairieKing::GetGameInstance()->IsCollidingWithMonster(attemptedPosition, this) ||
             PrairieKing::GetGameInstance()->m_deathTimer > 0.0f)
         {
@@ -5302,20 +5661,16 @@ std::vector<Vector2> PrairieKing::GetMonsterChancesForWave(int wave)
 Vector2 PrairieKing::GetRandomSpawnPosition()
 {
     const int tileSize = GetTileSize();
-    std::vector<Vector2> sideSpawnPositions = {
-        {0.0f, 6.0f * tileSize}, {0.0f, 7.0f * tileSize}, {0.0f, 8.0f * tileSize}, {15.0f * tileSize, 6.0f * tileSize}, {15.0f * tileSize, 7.0f * tileSize}, {15.0f * tileSize, 8.0f * tileSize}, {6.0f * tileSize, 0.0f}, {7.0f * tileSize, 0.0f}, {8.0f * tileSize, 0.0f}, {6.0f * tileSize, 15.0f * tileSize}, {7.0f * tileSize, 15.0f * tileSize}, {8.0f * tileSize, 15.0f * tileSize}};
 
-    for (int attempts = 0; attempts < 10; attempts++)
-    {
-        Vector2 pos = sideSpawnPositions[GetRandomInt(0, sideSpawnPositions.size() - 1)];
-        if (IsMapTilePassable(m_map[static_cast<int>(pos.x / tileSize)][static_cast<int>(pos.y / tileSize)]) &&
-            !IsCollidingWithMap(pos))
-        {
-            return pos;
-        }
-    }
+    // Spawn edges that are currently open
+    TileMask openSpawns = SPAWN_TILES & ~GetBlockedTiles(LAYER_PLAYER);
+
+    const TileMask &candidates = openSpawns.Any() ? openSpawns : SPAWN_TILES;
+    int x = 0;
+    int y = 0;
+    candidates.Nth(GetRandomInt(0, candidates.Count() - 1), x, y);
 
-    return sideSpawnPositions[GetRandomInt(0, sideSpawnPositions.size() - 1)];
+    return {static_cast<float>(x * tileSize), static_cast<float>(y * tileSize)};
 }
 
 int PrairieKing::ChooseMonsterType(const std::vector<Vector2> &chances)
@@ -5405,6 +5760,7 @@ void PrairieKing::HandleDebugInputs()
             delete monster;
         }
         m_monsters.clear();
+        m_monsterGrid.Clear();
         std::cout << "Cleared " << count << " monsters" << std::endl;
     }
 
@@ -5415,6 +5771,7 @@ void PrairieKing::HandleDebugInputs()
         for (auto monster : m_monsters)
             delete monster;
         m_monsters.clear();
+        m_monsterGrid.Clear();
         std::cout << "Cleared " << count << " monsters" << std::endl;
     }
 }
@@ -5461,41 +5818,59 @@ void PrairieKing::SpawnDebugPowerup(int type)
         m_playerPosition.x + GetRandomFloat(-50, 50),
         m_playerPosition.y + GetRandomFloat(-50, 50)};
 
-    m_powerups.push_back(CowboyPowerup(type, spawnPos, 10000));
+    AddPowerup(CowboyPowerup(type, spawnPos, 10000));
 }
 
-void PrairieKing::DrawDebugGrid()
+Camera2D PrairieKing::GetWorldCamera() const
+{
+    Camera2D camera = {};
+    camera.target = m_topLeftScreenCoordinate;
+    camera.zoom = 1.0f / PIXEL_ZOOM;
+    return camera;
+}
+
+Camera2D PrairieKing::GetHudCamera() const
+{
+    Camera2D camera = {};
+    camera.offset = m_topLeftScreenCoordinate;
+    camera.target = m_topLeftScreenCoordinate;
+    camera.zoom = static_cast<float>(VirtualScreen::GetScale(m_screenWidth, m_screenHeight)) / PIXEL_ZOOM;
+    return camera;
+}
+
+void PrairieKing::DrawDebugGrid(DrawList &list)
 {
     const int tileSize = GetTileSize();
 
-    // Draw grid
+    // Draw grid, one arena unit wide lines
     for (int x = 0; x <= MAP_WIDTH; x++)
     {
-        DrawLineV(
-            Vector2{m_topLeftScreenCoordinate.x + x * tileSize, m_topLeftScreenCoordinate.y},
-            Vector2{m_topLeftScreenCoordinate.x + x * tileSize, m_topLeftScreenCoordinate.y + MAP_HEIGHT * tileSize},
-            ColorAlpha(GRAY, 0.3f));
+        list.AddRectangle(m_topLeftScreenCoordinate.x + x * tileSize, m_topLeftScreenCoordinate.y,
+                          1.0f, MAP_HEIGHT * tileSize,
+                          ColorAlpha(GRAY, 0.3f));
     }
 
     for (int y = 0; y <= MAP_HEIGHT; y++)
     {
-        DrawLineV(
-            Vector2{m_topLeftScreenCoordinate.x, m_topLeftScreenCoordinate.y + y * tileSize},
-            Vector2{m_topLeftScreenCoordinate.x + MAP_WIDTH * tileSize, m_topLeftScreenCoordinate.y + y * tileSize},
-            ColorAlpha(GRAY, 0.3f));
+        list.AddRectangle(m_topLeftScreenCoordinate.x, m_topLeftScreenCoordinate.y + y * tileSize,
+                          MAP_WIDTH * tileSize, 1.0f,
+                          ColorAlpha(GRAY, 0.3f));
     }
 }
 
-void PrairieKing::DrawDebugInfo()
+void PrairieKing::DrawDebugText(DrawList &list, const char *text, float x, float y, Color color) const
+{
+    // Same size and spacing DrawText would use, but through the atlas copy of the default font
+    list.AddText(m_assets.GetFont(FontId::Small), text, Vector2{x, y}, 20, 2, color);
+}
+
+void PrairieKing::DrawDebugInfo(DrawList &list)
 {
     if (!m_debugMode)
         return;
 
     // Draw debug mode indicator
-    DrawText("DEBUG MODE", 10, 10, 20, RED);
-
-    // Draw debug grid
-    DrawDebugGrid();
+    DrawDebugText(list, "DEBUG MODE", 10, 10, RED);
 
     const float startY = 40; // Moved down to not overlap with debug indicator
     float currentY = startY;
@@ -5503,75 +5878,78 @@ void PrairieKing::DrawDebugInfo()
     const Color debugColor = YELLOW;
 
     // Draw FPS
-    DrawText(TextFormat("FPS: %d", GetFPS()), 10, currentY, 20, debugColor);
+    DrawDebugText(list, TextFormat("FPS: %d", m_fps), 10, currentY, debugColor);
     currentY += lineHeight;
 
     // Game State Info
-    DrawText(TextFormat("Wave: %d/%d", m_whichWave + 1, 12), 10, currentY, 20, debugColor);
+    DrawDebugText(list, TextFormat("Wave: %d/%d", m_whichWave + 1, 12), 10, currentY, debugColor);
     currentY += lineHeight;
 
-    DrawText(TextFormat("Wave Timer: %.1f", m_waveTimer / 1000.0f), 10, currentY, 20, debugColor);
+    DrawDebugText(list, TextFormat("Wave Timer: %.1f", m_waveTimer / 1000.0f), 10, currentY, debugColor);
     currentY += lineHeight;
 
-    DrawText(TextFormat("Player Pos: (%.1f, %.1f)", m_playerPosition.x, m_playerPosition.y),
-             10, currentY, 20, debugColor);
+    DrawDebugText(list, TextFormat("Player Pos: (%.1f, %.1f)", m_playerPosition.x, m_playerPosition.y),
+                  10, currentY, debugColor);
     currentY += lineHeight;
 
     // Entities count
-    DrawText(TextFormat("Monsters: %d", m_monsters.size()), 10, currentY, 20, debugColor);
+    DrawDebugText(list, TextFormat("Monsters: %d", m_monsters.size()), 10, currentY, debugColor);
     currentY += lineHeight;
 
-    DrawText(TextFormat("Bullets: %d", m_bullets.size()), 10, currentY, 20, debugColor);
+    DrawDebugText(list, TextFormat("Bullets: %d", m_bullets.size()), 10, currentY, debugColor);
     currentY += lineHeight;
 
-    DrawText(TextFormat("Powerups: %zu", m_powerups.size()), 10, currentY, 20, debugColor);
+    DrawDebugText(list, TextFormat("Powerups: %zu", m_powerups.size()), 10, currentY, debugColor);
     currentY += lineHeight;
 
     // Player Stats
-    DrawText(TextFormat("Lives: %d", m_lives), 10, currentY, 20, debugColor);
+    DrawDebugText(list, TextFormat("Lives: %d", m_lives), 10, currentY, debugColor);
     currentY += lineHeight;
 
-    DrawText(TextFormat("Damage: %d", m_bulletDamage), 10, currentY, 20, debugColor);
+    DrawDebugText(list, TextFormat("Damage: %d", m_bulletDamage), 10, currentY, debugColor);
     currentY += lineHeight;
 
     // Active powerups
     currentY += lineHeight;
-    DrawText("Active Powerups:", 10, currentY, 20, debugColor);
+    DrawDebugText(list, "Active Powerups:", 10, currentY, debugColor);
     currentY += lineHeight;
     for (const auto &powerup : m_activePowerups)
     {
-        DrawText(TextFormat("Type %d: %.1fs", powerup.first, powerup.second / 1000.0f),
-                 10, currentY, 20, debugColor);
+        DrawDebugText(list, TextFormat("Type %d: %.1fs", powerup.first, powerup.second / 1000.0f),
+                      10, currentY, debugColor);
         currentY += lineHeight;
     }
 
     // Debug Controls Help
-    const float rightCol = GetScreenWidth() - 200;
+    const float rightCol = m_screenWidth - 200;
     currentY = startY;
-    DrawText("Debug Controls:", rightCol, currentY, 20, debugColor);
+    DrawDebugText(list, "Debug Controls:", rightCol, currentY, debugColor);
     currentY += lineHeight;
-    DrawText("F3: Toggle Debug", rightCol, currentY, 20, debugColor);
+    DrawDebugText(list, "F3: Toggle Debug", rightCol, currentY, debugColor);
     currentY += lineHeight;
-    DrawText("F4: God Mode", rightCol, currentY, 20, debugColor);
+    DrawDebugText(list, "F4: God Mode", rightCol, currentY, debugColor);
     currentY += lineHeight;
-    DrawText("F5: Add Life", rightCol, currentY, 20, debugColor);
+    DrawDebugText(list, "F5: Add Life", rightCol, currentY, debugColor);
     currentY += lineHeight;
-    DrawText("F6: Add Coins", rightCol, currentY, 20, debugColor);
+    DrawDebugText(list, "F6: Add Coins", rightCol, currentY, debugColor);
     currentY += lineHeight;
-    DrawText("F7: Inc Damage", rightCol, currentY, 20, debugColor);
+    DrawDebugText(list, "F7: Inc Damage", rightCol, currentY, debugColor);
     currentY += lineHeight;
-    DrawText("F8: Clear Monsters", rightCol, currentY, 20, debugColor);
+    DrawDebugText(list, "F8: Clear Monsters", rightCol, currentY, debugColor);
     currentY += lineHeight;
-    DrawText("F9: Clear Wave", rightCol, currentY, 20, debugColor);
+    DrawDebugText(list, "F9: Clear Wave", rightCol, currentY, debugColor);
     currentY += lineHeight;
-    DrawText("Num1-7: Spawn Monster", rightCol, currentY, 20, debugColor);
+    DrawDebugText(list, "Num1-7: Spawn Monster", rightCol, currentY, debugColor);
     currentY += lineHeight;
-    DrawText("Num8-9: Spawn Powerup", rightCol, currentY, 20, debugColor);
+    DrawDebugText(list, "Num8-9: Spawn Powerup", rightCol, currentY, debugColor);
+}
 
+void PrairieKing::DrawDebugHitboxes(DrawList &list)
+{
     // Draw monster hitboxes
     for (const auto &monster : m_monsters)
     {
-        DrawRectangleLinesEx(
+        list.AddRectangleLines(
             Rectangle{
                 m_topLeftScreenCoordinate.x + monster->position.x,
                 m_topLeftScreenCoordinate.y + monster->position.y,
@@ -5582,7 +5960,7 @@ void PrairieKing::DrawDebugInfo()
     }
 
     // Draw player hitbox
-    DrawRectangleLinesEx(
+    list.AddRectangleLines(
         Rectangle{
             m_topLeftScreenCoordinate.x + m_playerBoundingBox.x,
             m_topLeftScreenCoordinate.y + m_playerBoundingBox.y,
@@ -5632,19 +6010,18 @@ void PrairieKing::ApplyPurchasedUpgrade(int itemId)
     }
 }
 
-void PrairieKing::DrawShopping(const Texture2D &texture, Vector2 topLeftScreenCoordinate)
+void PrairieKing::DrawShopping(DrawList &list, Vector2 topLeftScreenCoordinate)
 {
+    const float merchantDepth = GetCharacterDepth(m_merchantBox.y);
+
     // Draw arriving/leaving merchant animation
     if ((m_merchantArriving || m_merchantLeaving) && !m_merchantShopOpen)
     {
-        DrawTexturePro(texture,
-                       Rectangle{336.0f + ((m_shoppingTimer / 100 % 2 == 0) ? 16.0f : 0), 80, 16, 16},
+        list.AddSprite(Rectangle{336.0f + ((m_shoppingTimer / 100 % 2 == 0) ? 16.0f : 0), 80, 16, 16},
                        Rectangle{topLeftScreenCoordinate.x + m_merchantBox.x,
                                  topLeftScreenCoordinate.y + m_merchantBox.y,
                                  48, 48},
-                       Vector2{0, 0},
-                       0.0f,
-                       WHITE);
+                       merchantDepth);
     }
     else
     {
@@ -5653,68 +6030,28 @@ void PrairieKing::DrawShopping(const Texture2D &texture, Vector2 topLeftScreenCo
                                                                                                                                                    : 0;
 
         // Draw merchant
-        DrawTexturePro(texture,
-                       Rectangle{368.0f + whichFrame * 16, 80, 16, 16},
+        list.AddSprite(Rectangle{368.0f + whichFrame * 16, 80, 16, 16},
                        Rectangle{topLeftScreenCoordinate.x + m_merchantBox.x,
                                  topLeftScreenCoordinate.y + m_merchantBox.y,
                                  48, 48},
-                       Vector2{0, 0},
-                       0.0f,
-                       WHITE);
+                       merchantDepth);
 
         // Draw merchant shop counter
-        DrawTexturePro(texture,
-                       Rectangle{401, 96, 63, 32},
+        list.AddSprite(Rectangle{401, 96, 63, 32},
                        Rectangle{topLeftScreenCoordinate.x + m_merchantBox.x - GetTileSize(),
                                  topLeftScreenCoordinate.y + m_merchantBox.y + GetTileSize(),
                                  189, 96},
-                       Vector2{0, 0},
-                       0.0f,
-                       WHITE);
-
-        // Draw store items
-        for (const auto &item : m_storeItems)
-        {
-            // Draw item sprite
-            DrawTexturePro(texture,
-                           Rectangle{192.0f + item.second * 16, 128, 16, 16},
-                           Rectangle{topLeftScreenCoordinate.x + item.first.x,
-                                     topLeftScreenCoordinate.y + item.first.y,
+                       merchantDepth);
+
+        // Draw store items, queued after the counter at the same depth so they rest on it
+        for (int slot = 0; slot < m_storeItemCount; slot++)
+        {
+            const StoreItem &item = m_storeItems[slot];
+            list.AddSprite(Rectangle{192.0f + item.item * 16, 128, 16, 16},
+                           Rectangle{topLeftScreenCoordinate.x + item.bounds.x,
+                                     topLeftScreenCoordinate.y + item.bounds.y,
                                      48, 48},
-                           Vector2{0, 0},
-                           0.0f,
-                           WHITE);
-
-            // Draw item price
-            std::string priceText = std::to_string(GetPriceForItem(item.second));
-            Vector2 textSize = MeasureTextEx(m_assets.GetFont("small"), priceText.c_str(), 16, 1);
-
-            Color priceColor = {88, 29, 43, 255};
-
-            // Draw price with outline effect
-            DrawTextEx(m_assets.GetFont("small"),
-                       priceText.c_str(),
-                       Vector2{topLeftScreenCoordinate.x + item.first.x + GetTileSize() / 2 - textSize.x / 2,
-                               topLeftScreenCoordinate.y + item.first.y + GetTileSize() + 3},
-                       16,
-                       1,
-                       priceColor);
-
-            DrawTextEx(m_assets.GetFont("small"),
-                       priceText.c_str(),
-                       Vector2{topLeftScreenCoordinate.x + item.first.x + GetTileSize() / 2 - textSize.x / 2 - 1,
-                               topLeftScreenCoordinate.y + item.first.y + GetTileSize() + 3},
-                       16,
-                       1,
-                       priceColor);
-
-            DrawTextEx(m_assets.GetFont("small"),
-                       priceText.c_str(),
-                       Vector2{topLeftScreenCoordinate.x + item.first.x + GetTileSize() / 2 - textSize.x / 2 + 1,
-                               topLeftScreenCoordinate.y + item.first.y + GetTileSize() + 3},
-                       16,
-                       1,
-                       priceColor);
+                           merchantDepth);
         }
     }
 
@@ -5723,15 +6060,38 @@ void PrairieKing::DrawShopping(const Texture2D &texture, Vector2 topLeftScreenCo
         (m_merchantShopOpen || m_merchantLeaving || !m_shopping) &&
         m_shoppingTimer < 250)
     {
-
-        DrawTexturePro(texture,
-                       Rectangle{207, 102, 8, 8},
+        list.AddSprite(Rectangle{207, 102, 8, 8},
                        Rectangle{topLeftScreenCoordinate.x + 8.5f * GetTileSize() - 12,
                                  topLeftScreenCoordinate.y + 15.0f * GetTileSize(),
                                  24, 24},
-                       Vector2{0, 0},
-                       0.0f,
-                       WHITE);
+                       EFFECT_DEPTH);
+    }
+}
+
+void PrairieKing::DrawShopPrices(DrawList &list, Vector2 topLeftScreenCoordinate)
+{
+    if ((m_merchantArriving || m_merchantLeaving) && !m_merchantShopOpen)
+    {
+        return;
+    }
+
+    for (int slot = 0; slot < m_storeItemCount; slot++)
+    {
+        const StoreItem &item = m_storeItems[slot];
+
+        // Draw item price
+        TextRun &priceText = m_storePriceText[slot];
+        priceText.SetNumber(m_assets.GetFont(FontId::Small), "", GetPriceForItem(item.item), 16, 1);
+        Vector2 textSize = priceText.GetSize();
+
+        Color priceColor = {88, 29, 43, 255};
+        Vector2 pricePos = {topLeftScreenCoordinate.x + item.bounds.x + GetTileSize() / 2 - textSize.x / 2,
+                            topLeftScreenCoordinate.y + item.bounds.y + GetTileSize() + 3};
+
+        // Draw price with outline effect
+        list.AddText(priceText, pricePos, priceColor);
+        list.AddText(priceText, Vector2{pricePos.x - 1, pricePos.y}, priceColor);
+        list.AddText(priceText, Vector2{pricePos.x + 1, pricePos.y}, priceColor);
     }
 }
 
@@ -5741,12 +6101,12 @@ void PrairieKing::PauseScreen()
     if (IsKeyPressed(GameKeys::ShootUp))
     {
         m_pauseOption = std::max(0, m_pauseOption - 1);
-        PlaySound(GetSound("Cowboy_gunshot"));
+        PlaySound(GetSound(SoundId::CowboyGunshot));
     }
     if (IsKeyPressed(GameKeys::ShootDown))
     {
         m_pauseOption = std::min(2, m_pauseOption + 1);
-        PlaySound(GetSound("Cowboy_gunshot"));
+        PlaySound(GetSound(SoundId::CowboyGunshot));
     }
 
     if (IsKeyPressed(GameKeys::SelectOption))
@@ -5767,6 +6127,13 @@ void PrairieKing::PauseScreen()
         }
     }
 
+    // ESC on the settings page goes back to the pause menu
+    if (m_showPauseSettings && IsKeyPressed(GameKeys::Exit))
+    {
+        m_showPauseSettings = false;
+        return;
+    }
+
     if (IsKeyPressed(GameKeys::Pause) || IsKeyPressed(GameKeys::Exit))
     {
         m_isPaused = false;
@@ -5778,7 +6145,7 @@ void PrairieKing::PauseScreen()
 // DRACULA IMPLEMENTATION
 // ====================
 
-void PrairieKing::Dracula::Draw(const Texture2D &texture, Vector2 topLeftScreenCoordinate)
+void PrairieKing::Dracula::DrawOverlay(DrawList &list, Vector2 topLeftScreenCoordinate)
 {
     // Draw health bar if not in gloating phase
     if (phase != GLOATING_PHASE)
@@ -5791,9 +6158,12 @@ void PrairieKing::Dracula::Draw(const Texture2D &texture, Vector2 topLeftScreenC
             static_cast<int>(topLeftScreenCoordinate.y) + 16 * PrairieKing::GetGameInstance()->GetTileSize() + 3,
             healthBarWidth,
             PrairieKing::GetGameInstance()->GetTileSize() / 3};
-        DrawRectangleRec(healthBar, Color{188, 51, 74, 255});
+        list.AddRectangle(healthBar, Color{188, 51, 74, 255});
     }
+}
 
+void PrairieKing::Dracula::Draw(DrawList &list, Vector2 topLeftScreenCoordinate)
+{
     // Draw Dracula sprite based on phase and flash state
     Rectangle sourceRect;
     Vector2 drawPos = {topLeftScreenCoordinate.x + position.x, topLeftScreenCoordinate.y + position.y};
@@ -5822,9 +6192,10 @@ void PrairieKing::Dracula::Draw(const Texture2D &texture, Vector2 topLeftScreenC
     }
 
     // Draw the main Dracula sprite with proper x3 scaling
-    DrawTexturePro(texture, sourceRect,
+    const float depth = GetCharacterDepth(position.y);
+    list.AddSprite(sourceRect,
                    Rectangle{drawPos.x, drawPos.y, 48, 48}, // 16 * 3 = 48 for proper scaling
-                   Vector2{0, 0}, 0.0f, WHITE);
+                   depth);
 
     // Special effects for gloating phase
     if (phase == GLOATING_PHASE && flashColorTimer <= 0.0f)
@@ -5833,18 +6204,18 @@ void PrairieKing::Dracula::Draw(const Texture2D &texture, Vector2 topLeftScreenC
         Vector2 capePos = {drawPos.x, drawPos.y + PrairieKing::GetGameInstance()->GetTileSize() +
                                           sinf(static_cast<float>(phaseInternalTimer) / 1000.0f) * 3.0f};
         Rectangle capeRect = {528, 176, 16, 16};
-        DrawTexturePro(texture, capeRect,
+        list.AddSprite(capeRect,
                        Rectangle{capePos.x, capePos.y, 48, 48}, // 16 * 3 = 48 for proper scaling
-                       Vector2{0, 0}, 0.0f, WHITE);
+                       depth);
 
         // Draw speech bubble (already properly scaled at 96x96)
         Vector2 bubblePos = {drawPos.x - PrairieKing::GetGameInstance()->GetTileSize() / 2,
                              drawPos.y - PrairieKing::GetGameInstance()->GetTileSize() * 2};
         Rectangle bubbleRect = {480, 80, 32, 32};
 
-        DrawTexturePro(texture, bubbleRect,
+        list.AddSprite(bubbleRect,
                        Rectangle{bubblePos.x, bubblePos.y, 96, 96}, // 32 * 3 = 96, already correct
-                       Vector2{0, 0}, 0.0f, WHITE);
+                       EFFECT_DEPTH);
     }
 }
 
@@ -5867,10 +6238,18 @@ bool PrairieKing::Dracula::TakeDamage(int damage)
     }
 
     flashColorTimer = 100.0f;
-    PlaySound(PrairieKing::GetGameInstance()->GetSound("cowboy_monsterhit"));
+    PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyMonsterHit));
     return false;
 }
 
+// Boss shots aim at the middle of the player's tile
+Vector2 PrairieKing::CowboyMonster::GetPlayerAimPoint()
+{
+    PrairieKing *game = PrairieKing::GetGameInstance();
+    return {game->m_playerPosition.x + game->GetTileSize() / 2.0f,
+            game->m_playerPosition.y + game->GetTileSize() / 2.0f};
+}
+
 bool PrairieKing::Dracula::Move(Vector2 playerPosition, float deltaTime)
 {
     // Update flash timer
@@ -5889,7 +6268,7 @@ bool PrairieKing::Dracula::Move(Vector2 playerPosition, float deltaTime)
         {
             phaseInternalCounter = 0;
             // Start boss music
-            PlaySound(PrairieKing::GetGameInstance()->GetSound("cowboy_boss"));
+            PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyBoss));
             phase = WALK_RANDOMLY_AND_SHOOT_PHASE;
         }
         break;
@@ -5959,7 +6338,7 @@ bool PrairieKing::Dracula::Move(Vector2 playerPosition, float deltaTime)
             attemptedPosition.x = position.x - (attemptedPosition.x - position.x);
             attemptedPosition.y = position.y - (attemptedPosition.y - position.y);
 
-            if (!PrairieKing::GetGameInstance()->IsCollidingWithMapForMonsters(attemptedPosition) &&
+            if (!PrairieKing::GetGameInstance()->IsCollidingWithMap(attemptedPosition, LAYER_WALKER) &&
                 !PrairieKing::GetGameInstance()->IsCollidingWithMonster(attemptedPosition, this))
             {
                 position = attemptedPosition;
@@ -5971,8 +6350,7 @@ bool PrairieKing::Dracula::Move(Vector2 playerPosition, float deltaTime)
             {
                 Vector2 trajectory = GetVelocityTowardPoint(
                     {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f, position.y},
-                    {playerPosition.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
-                     playerPosition.y + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
+                    GetPlayerAimPoint(),
                     8.0f);
 
                 // Predict player movement
@@ -5999,14 +6377,13 @@ bool PrairieKing::Dracula::Move(Vector2 playerPosition, float deltaTime)
                     trajectory.y += prediction.y;
                 }
 
-                PrairieKing::GetGameInstance()->m_enemyBullets.push_back(
-                    PrairieKing::CowboyBullet(
-                        {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
-                         position.y + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
-                        trajectory, 1));
+                PrairieKing::GetGameInstance()->m_enemyBullets.Add(
+                    {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
+                     position.y + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
+                    trajectory);
 
                 shootTimer = 250;
-                PlaySound(PrairieKing::GetGameInstance()->GetSound("Cowboy_gunshot"));
+                PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyGunshot));
             }
         }
     }
@@ -6130,17 +6507,15 @@ bool PrairieKing::Dracula::Move(Vector2 playerPosition, float deltaTime)
                 // Aimed shot at player
                 Vector2 trajectory = GetVelocityTowardPoint(
                     {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f, position.y},
-                    {playerPosition.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
-                     playerPosition.y + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
+                    GetPlayerAimPoint(),
                     8.0f);
 
-                PrairieKing::GetGameInstance()->m_enemyBullets.push_back(
-                    PrairieKing::CowboyBullet(
-                        {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
-                         position.y + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
-                        trajectory, 1));
+                PrairieKing::GetGameInstance()->m_enemyBullets.Add(
+                    {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
+                     position.y + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
+                    trajectory);
 
-                PlaySound(PrairieKing::GetGameInstance()->GetSound("Cowboy_gunshot"));
+                PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyGunshot));
             }
         }
         else if (phaseInternalCounter == 4)
@@ -6151,20 +6526,18 @@ bool PrairieKing::Dracula::Move(Vector2 playerPosition, float deltaTime)
                 // Random spread shots
                 Vector2 trajectory = GetVelocityTowardPoint(
                     {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f, position.y},
-                    {playerPosition.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
-                     playerPosition.y + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
+                    GetPlayerAimPoint(),
                     8.0f);
 
                 trajectory.x += GetRandomFloat(-1.0f, 1.0f);
                 trajectory.y += GetRandomFloat(-1.0f, 1.0f);
 
-                PrairieKing::GetGameInstance()->m_enemyBullets.push_back(
-                    PrairieKing::CowboyBullet(
-                        {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
-                         position.y + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
-                        trajectory, 1));
+                PrairieKing::GetGameInstance()->m_enemyBullets.Add(
+                    {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
+                     position.y + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
+                    trajectory);
 
-                PlaySound(PrairieKing::GetGameInstance()->GetSound("Cowboy_gunshot"));
+                PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyGunshot));
                 shootTimer = 200;
             }
 
@@ -6218,11 +6591,10 @@ void PrairieKing::Dracula::FireSpread(Vector2 origin, double offsetAngle)
             trajectory = GetVelocityTowardPoint(origin, {newX, newY}, 8.0f);
         }
 
-        PrairieKing::GetGameInstance()->m_enemyBullets.push_back(
-            PrairieKing::CowboyBullet(origin, trajectory, 1));
+        PrairieKing::GetGameInstance()->m_enemyBullets.Add(origin, trajectory);
     }
 
-    PlaySound(PrairieKing::GetGameInstance()->GetSound("Cowboy_gunshot"));
+    PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyGunshot));
 }
 
 void PrairieKing::Dracula::SummonEnemies(Vector2 origin, int which)
@@ -6266,7 +6638,7 @@ void PrairieKing::Dracula::SummonEnemies(Vector2 origin, int which)
                                static_cast<float>(PrairieKing::GetGameInstance()->GetTileSize())};
 
         // Check for collisions before spawning
-        if (!PrairieKing::GetGameInstance()->IsCollidingWithMapForMonsters(spawnRect) &&
+        if (!PrairieKing::GetGameInstance()->IsCollidingWithMap(spawnRect, LAYER_WALKER) &&
             !PrairieKing::GetGameInstance()->IsCollidingWithMonster(spawnRect, nullptr))
         {
             try
@@ -6300,7 +6672,7 @@ void PrairieKing::Dracula::SummonEnemies(Vector2 origin, int which)
     // Only play sound if at least one monster was spawned
     if (successfulSpawns > 0)
     {
-        PlaySound(PrairieKing::GetGameInstance()->GetSound("Cowboy_monsterDie"));
+        PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyMonsterDie));
     }
 }
 
@@ -6308,7 +6680,7 @@ void PrairieKing::Dracula::SummonEnemies(Vector2 origin, int which)
 // OUTLAW IMPLEMENTATION
 // ====================
 
-void PrairieKing::Outlaw::Draw(const Texture2D &texture, Vector2 topLeftScreenCoordinate)
+void PrairieKing::Outlaw::DrawOverlay(DrawList &list, Vector2 topLeftScreenCoordinate)
 {
     // Draw health bar
     float healthPercentage = static_cast<float>(health) / static_cast<float>(fullHealth);
@@ -6319,8 +6691,11 @@ void PrairieKing::Outlaw::Draw(const Texture2D &texture, Vector2 topLeftScreenCo
         static_cast<int>(topLeftScreenCoordinate.y) + 16 * PrairieKing::GetGameInstance()->GetTileSize() + 3,
         healthBarWidth,
         PrairieKing::GetGameInstance()->GetTileSize() / 3};
-    DrawRectangleRec(healthBar, Color{188, 51, 74, 255});
+    list.AddRectangle(healthBar, Color{188, 51, 74, 255});
+}
 
+void PrairieKing::Outlaw::Draw(DrawList &list, Vector2 topLeftScreenCoordinate)
+{
     Vector2 drawPos = {topLeftScreenCoordinate.x + position.x, topLeftScreenCoordinate.y + position.y};
     Rectangle sourceRect;
 
@@ -6345,9 +6720,9 @@ void PrairieKing::Outlaw::Draw(const Texture2D &texture, Vector2 topLeftScreenCo
                                      drawPos.y - PrairieKing::GetGameInstance()->GetTileSize() * 2};
                 Rectangle bubbleRect = {448 + ((PrairieKing::GetGameInstance()->m_whichWave > 5) ? 32 : 0),
                                         144, 32, 32};
-                DrawTexturePro(texture, bubbleRect,
+                list.AddSprite(bubbleRect,
                                Rectangle{bubblePos.x, bubblePos.y, 96, 96}, // 32 * 3 = 96 for proper scaling
-                               Vector2{0, 0}, 0.0f, WHITE);
+                               EFFECT_DEPTH);
             }
             break;
 
@@ -6371,9 +6746,9 @@ void PrairieKing::Outlaw::Draw(const Texture2D &texture, Vector2 topLeftScreenCo
         }
     }
 
-    DrawTexturePro(texture, sourceRect,
+    list.AddSprite(sourceRect,
                    Rectangle{drawPos.x, drawPos.y, 48, 48}, // 16 * 3 = 48 for proper scaling
-                   Vector2{0, 0}, 0.0f, WHITE);
+                   GetCharacterDepth(position.y));
 }
 
 bool PrairieKing::Outlaw::Move(Vector2 playerPosition, float deltaTime)
@@ -6456,18 +6831,16 @@ bool PrairieKing::Outlaw::Move(Vector2 playerPosition, float deltaTime)
             {
                 Vector2 trajectory = GetVelocityTowardPoint(
                     {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f, position.y},
-                    {playerPosition.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
-                     playerPosition.y + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
+                    GetPlayerAimPoint(),
                     8.0f);
 
-                PrairieKing::GetGameInstance()->m_enemyBullets.push_back(
-                    PrairieKing::CowboyBullet(
-                        {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
-                         position.y - PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
-                        trajectory, 1));
+                PrairieKing::GetGameInstance()->m_enemyBullets.Add(
+                    {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
+                     position.y - PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
+                    trajectory);
 
                 shootTimer = 120;
-                PlaySound(PrairieKing::GetGameInstance()->GetSound("Cowboy_gunshot"));
+                PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyGunshot));
             }
 
             if (phaseInternalTimer <= 0)
@@ -6535,14 +6908,13 @@ bool PrairieKing::Outlaw::Move(Vector2 playerPosition, float deltaTime)
 
             if (shootTimer <= 0)
             {
-                PrairieKing::GetGameInstance()->m_enemyBullets.push_back(
-                    PrairieKing::CowboyBullet(
-                        {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
-                         position.y - PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
-                        {static_cast<float>(GetRandomInt(-2, 3)), -8.0f}, 1));
+                PrairieKing::GetGameInstance()->m_enemyBullets.Add(
+                    {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
+                     position.y - PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
+                    {static_cast<float>(GetRandomInt(-2, 3)), -8.0f});
 
                 shootTimer = 150;
-                PlaySound(PrairieKing::GetGameInstance()->GetSound("Cowboy_gunshot"));
+                PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyGunshot));
             }
 
             if (phaseInternalTimer <= 0)
@@ -6611,18 +6983,17 @@ bool PrairieKing::Outlaw::Move(Vector2 playerPosition, float deltaTime)
             shootTimer -= static_cast<int>(deltaTime * 1000.0f);
             if (shootTimer <= 0)
             {
-                PrairieKing::GetGameInstance()->m_enemyBullets.push_back(
-                    PrairieKing::CowboyBullet(
-                        {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
-                         position.y - PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
-                        {static_cast<float>(GetRandomInt(-1, 2)), -8.0f}, 1));
+                PrairieKing::GetGameInstance()->m_enemyBullets.Add(
+                    {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
+                     position.y - PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
+                    {static_cast<float>(GetRandomInt(-1, 2)), -8.0f});
 
                 shootTimer = (fullHealth > 50) ? 200 : 250;
                 if (GetRandomFloat(0.0f, 1.0f) < 0.2f)
                 {
                     shootTimer = 150;
                 }
-                PlaySound(PrairieKing::GetGameInstance()->GetSound("Cowboy_gunshot"));
+                PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyGunshot));
             }
 
             if (phaseInternalTimer <= 0)
@@ -6688,18 +7059,17 @@ bool PrairieKing::Outlaw::Move(Vector2 playerPosition, float deltaTime)
             shootTimer -= static_cast<int>(deltaTime * 1000.0f);
             if (shootTimer <= 0)
             {
-                PrairieKing::GetGameInstance()->m_enemyBullets.push_back(
-                    PrairieKing::CowboyBullet(
-                        {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
-                         position.y - PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
-                        {static_cast<float>(GetRandomInt(-1, 2)), -8.0f}, 1));
+                PrairieKing::GetGameInstance()->m_enemyBullets.Add(
+                    {position.x + PrairieKing::GetGameInstance()->GetTileSize() / 2.0f,
+                     position.y - PrairieKing::GetGameInstance()->GetTileSize() / 2.0f},
+                    {static_cast<float>(GetRandomInt(-1, 2)), -8.0f});
 
                 shootTimer = (fullHealth > 50) ? 200 : 250;
                 if (GetRandomFloat(0.0f, 1.0f) < 0.2f)
                 {
                     shootTimer = 150;
                 }
-                PlaySound(PrairieKing::GetGameInstance()->GetSound("Cowboy_gunshot"));
+                PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyGunshot));
             }
 
             if (phaseInternalTimer <= 0)
@@ -6772,6 +7142,6 @@ bool PrairieKing::Outlaw::TakeDamage(int damage)
     }
 
     flashColorTimer = 150.0f;
-    PlaySound(PrairieKing::GetGameInstance()->GetSound("cowboy_monsterhit"));
+    PlaySound(PrairieKing::GetGameInstance()->GetSound(SoundId::CowboyMonsterHit));
     return false;
 }
\ No newline at end of file
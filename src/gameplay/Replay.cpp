@@ -0,0 +1,105 @@
+#include "gameplay/Replay.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    // Indexed by PrairieKing::GameKeys
+    const char *const KEY_NAMES[] = {
+        "MoveLeft", "MoveRight", "MoveUp", "MoveDown",
+        "ShootLeft", "ShootRight", "ShootUp", "ShootDown",
+        "UsePowerup", "SelectOption", "Exit",
+        "DebugToggle",
+        "DebugSpawn1", "DebugSpawn2", "DebugSpawn3", "DebugSpawn4", "DebugSpawn5",
+        "DebugSpawn6", "DebugSpawn7", "DebugSpawn8", "DebugSpawn9",
+        "DebugGodMode", "DebugAddLife", "DebugAddCoins", "DebugIncDamage",
+        "DebugClearMonsters", "DebugClearWave",
+        "Pause"};
+
+    static_assert(sizeof(KEY_NAMES) / sizeof(KEY_NAMES[0]) == static_cast<size_t>(PrairieKing::GameKeys::MAX),
+                  "One name per GameKeys value");
+}
+
+bool Replay::ParseKey(const std::string &name, PrairieKing::GameKeys &key)
+{
+    for (int i = 0; i < static_cast<int>(PrairieKing::GameKeys::MAX); i++)
+    {
+        if (name == KEY_NAMES[i])
+        {
+            key = static_cast<PrairieKing::GameKeys>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Replay::Load(const std::string &path)
+{
+    m_seed = 0;
+    m_events.clear();
+    m_next = 0;
+    m_error.clear();
+
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        m_error = "can't open " + path;
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        lineNumber++;
+        std::istringstream in(line);
+        std::string first;
+        if (!(in >> first) || first[0] == '#')
+        {
+            continue;
+        }
+
+        if (first == "seed")
+        {
+            if (!(in >> m_seed))
+            {
+                m_error = path + ":" + std::to_string(lineNumber) + ": expected a seed value";
+                return false;
+            }
+            continue;
+        }
+
+        Event event;
+        std::string action;
+        std::istringstream tickIn(first);
+        if (!(tickIn >> event.tick) || event.tick < 0 || !(in >> action) || action.size() < 2 ||
+            (action[0] != '+' && action[0] != '-') || !ParseKey(action.substr(1), event.key))
+        {
+            m_error = path + ":" + std::to_string(lineNumber) + ": expected \"<tick> +Key\" or \"<tick> -Key\"";
+            return false;
+        }
+        event.pressed = action[0] == '+';
+        m_events.push_back(event);
+    }
+
+    // Events may be written in any order; same-tick events keep file order
+    std::stable_sort(m_events.begin(), m_events.end(), [](const Event &a, const Event &b)
+                     { return a.tick < b.tick; });
+    return true;
+}
+
+void Replay::Apply(PrairieKing &game, int tick)
+{
+    while (m_next < m_events.size() && m_events[m_next].tick <= tick)
+    {
+        const Event &event = m_events[m_next++];
+
+        // The game toggles pause on every Pause event; the P key only ever sends presses
+        if (event.key == PrairieKing::GameKeys::Pause && !event.pressed)
+        {
+            continue;
+        }
+        game.SetButtonState(event.key, event.pressed);
+    }
+}
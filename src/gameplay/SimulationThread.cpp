@@ -0,0 +1,74 @@
+#include "gameplay/SimulationThread.hpp"
+
+SimulationThread::SimulationThread(AssetManager &assets)
+{
+    m_game = std::make_unique<PrairieKing>(assets);
+
+    // Record the opening frame here, so there is something to draw before the first tick
+    m_game->Draw(m_lists[m_front]);
+    m_status.gameOver = m_game->IsGameOver();
+    m_status.returnToMenu = m_game->ShouldReturnToMenu();
+    m_status.closeRequested = m_game->IsCloseRequested();
+
+    m_thread = std::thread(&SimulationThread::Run, this);
+}
+
+SimulationThread::~SimulationThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+}
+
+void SimulationThread::Step(const PrairieKing::InputFrame &input, float deltaTime)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return !m_busy; });
+
+    if (m_ready)
+    {
+        m_front = 1 - m_front;
+        m_ready = false;
+    }
+
+    // The worker is idle, so the game can be read without racing it
+    m_status.gameOver = m_game->IsGameOver();
+    m_status.returnToMenu = m_game->ShouldReturnToMenu();
+    m_status.closeRequested = m_game->IsCloseRequested();
+
+    m_input = input;
+    m_deltaTime = deltaTime;
+    m_busy = true;
+    lock.unlock();
+    m_wake.notify_one();
+}
+
+void SimulationThread::Run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_wake.wait(lock, [this] { return m_busy || m_stop; });
+        if (m_stop)
+        {
+            return;
+        }
+
+        // The main thread only reads m_lists[m_front] until the next Step, which waits
+        // for this tick, so the back list is ours without holding the lock
+        DrawList &back = m_lists[1 - m_front];
+        lock.unlock();
+
+        m_game->ApplyInput(m_input);
+        m_game->Update(m_deltaTime);
+        m_game->Draw(back);
+
+        lock.lock();
+        m_busy = false;
+        m_ready = true;
+        m_done.notify_one();
+    }
+}
@@ -0,0 +1,160 @@
+#include "gameplay/SpriteBatch.hpp"
+#include "rlgl.h"
+#include <cmath>
+#include <cstring>
+
+uint32_t SpriteBatch::DepthKey(float depth)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &depth, sizeof(bits));
+    // Negative floats sort reversed, so flip all their bits; positives just need the sign bit set
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+void SpriteBatch::SortByDepth()
+{
+    const size_t count = m_keys.size();
+    m_order.resize(count);
+    m_scratch.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        m_order[i] = static_cast<uint32_t>(i);
+    }
+
+    // LSD radix sort of the indices, one byte per pass. Each pass is stable, so sprites
+    // with the same depth stay in submission order
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        size_t histogram[256] = {};
+        for (size_t i = 0; i < count; i++)
+        {
+            histogram[(m_keys[i] >> shift) & 0xFFu]++;
+        }
+
+        // Most frames only use a handful of depths; skip bytes that are the same for all keys
+        if (histogram[(m_keys[0] >> shift) & 0xFFu] == count)
+        {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (size_t &bucket : histogram)
+        {
+            size_t bucketCount = bucket;
+            bucket = offset;
+            offset += bucketCount;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t index = m_order[i];
+            m_scratch[histogram[(m_keys[index] >> shift) & 0xFFu]++] = index;
+        }
+        m_order.swap(m_scratch);
+    }
+}
+
+void SpriteBatch::Flush(const Texture2D &atlas)
+{
+    if (m_sprites.empty())
+    {
+        return;
+    }
+
+    SortByDepth();
+    Submit(atlas, m_order.size());
+    Clear();
+}
+
+void SpriteBatch::FlushBelow(const Texture2D &atlas, float maxDepth)
+{
+    if (m_sprites.empty())
+    {
+        return;
+    }
+
+    SortByDepth();
+    const uint32_t limit = DepthKey(maxDepth);
+    size_t count = 0;
+    while (count < m_order.size() && m_keys[m_order[count]] < limit)
+    {
+        count++;
+    }
+    Submit(atlas, count);
+
+    // Keep the remainder in sorted order; the next sort is stable so it stays that way
+    std::vector<Sprite> remaining;
+    std::vector<uint32_t> remainingKeys;
+    remaining.reserve(m_order.size() - count);
+    remainingKeys.reserve(m_order.size() - count);
+    for (size_t i = count; i < m_order.size(); i++)
+    {
+        remaining.push_back(m_sprites[m_order[i]]);
+        remainingKeys.push_back(m_keys[m_order[i]]);
+    }
+    m_sprites.swap(remaining);
+    m_keys.swap(remainingKeys);
+}
+
+void SpriteBatch::Submit(const Texture2D &atlas, size_t count) const
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    const float width = static_cast<float>(atlas.width);
+    const float height = static_cast<float>(atlas.height);
+
+    // rlgl merges consecutive quads with the same texture into one draw call, so binding
+    // the atlas once keeps the whole queue in a single batch (rlCheckRenderBatchLimit
+    // only splits it when the vertex buffer fills up)
+    rlSetTexture(atlas.id);
+    for (size_t n = 0; n < count; n++)
+    {
+        const Sprite &sprite = m_sprites[m_order[n]];
+        const Rectangle &src = sprite.source;
+        const Rectangle &dst = sprite.dest;
+
+        float left = src.x / width;
+        float right = (src.x + src.width) / width;
+        if (sprite.flipX)
+        {
+            float swap = left;
+            left = right;
+            right = swap;
+        }
+        const float top = src.y / height;
+        const float bottom = (src.y + src.height) / height;
+
+        // Corners rotate around the top-left of dest, like DrawTexturePro with a zero origin
+        Vector2 topLeft = {dst.x, dst.y};
+        Vector2 topRight = {dst.x + dst.width, dst.y};
+        Vector2 bottomLeft = {dst.x, dst.y + dst.height};
+        Vector2 bottomRight = {dst.x + dst.width, dst.y + dst.height};
+        if (sprite.rotation != 0.0f)
+        {
+            const float s = std::sin(sprite.rotation * DEG2RAD);
+            const float c = std::cos(sprite.rotation * DEG2RAD);
+            topRight = {dst.x + dst.width * c, dst.y + dst.width * s};
+            bottomLeft = {dst.x - dst.height * s, dst.y + dst.height * c};
+            bottomRight = {dst.x + dst.width * c - dst.height * s, dst.y + dst.width * s + dst.height * c};
+        }
+
+        rlCheckRenderBatchLimit(4);
+        rlBegin(RL_QUADS);
+        rlColor4ub(sprite.tint.r, sprite.tint.g, sprite.tint.b, sprite.tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        rlTexCoord2f(left, top);
+        rlVertex2f(topLeft.x, topLeft.y);
+        rlTexCoord2f(left, bottom);
+        rlVertex2f(bottomLeft.x, bottomLeft.y);
+        rlTexCoord2f(right, bottom);
+        rlVertex2f(bottomRight.x, bottomRight.y);
+        rlTexCoord2f(right, top);
+        rlVertex2f(topRight.x, topRight.y);
+        rlEnd();
+    }
+    rlSetTexture(0);
+}
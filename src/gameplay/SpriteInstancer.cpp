@@ -0,0 +1,186 @@
+#include "gameplay/SpriteInstancer.hpp"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+
+namespace
+{
+    // Instance attribute: xy = top-left in the caller's units, z = animation frame
+    const char *const VERTEX_SHADER = R"(#version 330
+layout(location = 0) in vec2 corner;
+layout(location = 1) in vec3 instance;
+
+uniform mat4 mvp;
+uniform vec4 source; // x, y, width, height in texture coordinates
+uniform vec2 size;
+
+out vec2 fragTexCoord;
+
+void main()
+{
+    fragTexCoord = source.xy + vec2(instance.z * source.z, 0.0) + corner * source.zw;
+    gl_Position = mvp * vec4(instance.xy + corner * size, 0.0, 1.0);
+}
+)";
+
+    const char *const FRAGMENT_SHADER = R"(#version 330
+in vec2 fragTexCoord;
+
+uniform sampler2D texture0;
+uniform vec4 tint;
+
+out vec4 finalColor;
+
+void main()
+{
+    finalColor = texture(texture0, fragTexCoord) * tint;
+}
+)";
+
+    // Two triangles covering the unit square
+    const float QUAD_CORNERS[] = {
+        0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f,
+        0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f};
+
+    constexpr int CORNER_LOCATION = 0;
+    constexpr int INSTANCE_LOCATION = 1;
+    constexpr size_t MIN_INSTANCE_CAPACITY = 256;
+}
+
+SpriteInstancer::~SpriteInstancer()
+{
+    if (!m_instanced)
+    {
+        return;
+    }
+
+    rlUnloadVertexArray(m_vertexArray);
+    rlUnloadVertexBuffer(m_quadBuffer);
+    rlUnloadVertexBuffer(m_instanceBuffer);
+    rlUnloadShaderProgram(m_shader);
+}
+
+bool SpriteInstancer::IsInstanced()
+{
+    if (!m_loaded)
+    {
+        Load();
+    }
+    return m_instanced;
+}
+
+void SpriteInstancer::Load()
+{
+    m_loaded = true;
+
+    // GLSL 330 and glDrawArraysInstanced need a desktop 3.3+ context (Mesa llvmpipe qualifies)
+    const int version = rlGetVersion();
+    if (version != RL_OPENGL_33 && version != RL_OPENGL_43)
+    {
+        return;
+    }
+
+    m_shader = rlLoadShaderCode(VERTEX_SHADER, FRAGMENT_SHADER);
+    if (m_shader == 0)
+    {
+        return;
+    }
+    m_mvpLocation = rlGetLocationUniform(m_shader, "mvp");
+    m_sourceLocation = rlGetLocationUniform(m_shader, "source");
+    m_sizeLocation = rlGetLocationUniform(m_shader, "size");
+    m_tintLocation = rlGetLocationUniform(m_shader, "tint");
+
+    m_vertexArray = rlLoadVertexArray();
+    rlEnableVertexArray(m_vertexArray);
+
+    m_quadBuffer = rlLoadVertexBuffer(QUAD_CORNERS, sizeof(QUAD_CORNERS), false);
+    rlSetVertexAttribute(CORNER_LOCATION, 2, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(CORNER_LOCATION);
+
+    rlDisableVertexArray();
+
+    m_instanced = true;
+    ReserveBuffer(MIN_INSTANCE_CAPACITY);
+}
+
+void SpriteInstancer::ReserveBuffer(size_t count)
+{
+    if (count <= m_instanceCapacity)
+    {
+        return;
+    }
+
+    m_instanceCapacity = std::max(count, m_instanceCapacity * 2);
+
+    rlEnableVertexArray(m_vertexArray);
+    if (m_instanceBuffer != 0)
+    {
+        rlUnloadVertexBuffer(m_instanceBuffer);
+    }
+    m_instanceBuffer = rlLoadVertexBuffer(nullptr, static_cast<int>(m_instanceCapacity * sizeof(Instance)), true);
+    rlSetVertexAttribute(INSTANCE_LOCATION, 3, RL_FLOAT, false, sizeof(Instance), 0);
+    rlSetVertexAttributeDivisor(INSTANCE_LOCATION, 1);
+    rlEnableVertexAttribute(INSTANCE_LOCATION);
+    rlDisableVertexArray();
+}
+
+void SpriteInstancer::Draw(const Texture2D &atlas, const Rectangle &source, Vector2 size, Color tint)
+{
+    if (m_instances.empty())
+    {
+        return;
+    }
+
+    if (IsInstanced())
+    {
+        DrawInstanced(atlas, source, size, tint);
+    }
+    else
+    {
+        DrawBatched(atlas, source, size, tint);
+    }
+    m_instances.clear();
+}
+
+void SpriteInstancer::DrawInstanced(const Texture2D &atlas, const Rectangle &source, Vector2 size, Color tint)
+{
+    // Anything rlgl has queued so far has to reach the screen before our own draw call
+    rlDrawRenderBatchActive();
+
+    ReserveBuffer(m_instances.size());
+    rlUpdateVertexBuffer(m_instanceBuffer, m_instances.data(),
+                         static_cast<int>(m_instances.size() * sizeof(Instance)), 0);
+
+    const float width = static_cast<float>(atlas.width);
+    const float height = static_cast<float>(atlas.height);
+    const float sourceUv[4] = {source.x / width, source.y / height, source.width / width, source.height / height};
+    const float sizeValue[2] = {size.x, size.y};
+    const float tintValue[4] = {tint.r / 255.0f, tint.g / 255.0f, tint.b / 255.0f, tint.a / 255.0f};
+
+    rlEnableShader(m_shader);
+    rlSetUniformMatrix(m_mvpLocation, MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+    rlSetUniform(m_sourceLocation, sourceUv, RL_SHADER_UNIFORM_VEC4, 1);
+    rlSetUniform(m_sizeLocation, sizeValue, RL_SHADER_UNIFORM_VEC2, 1);
+    rlSetUniform(m_tintLocation, tintValue, RL_SHADER_UNIFORM_VEC4, 1);
+
+    rlActiveTextureSlot(0);
+    rlEnableTexture(atlas.id);
+
+    rlEnableVertexArray(m_vertexArray);
+    rlDrawVertexArrayInstanced(0, 6, static_cast<int>(m_instances.size()));
+    rlDisableVertexArray();
+
+    rlDisableTexture();
+    rlDisableShader();
+}
+
+void SpriteInstancer::DrawBatched(const Texture2D &atlas, const Rectangle &source, Vector2 size, Color tint) const
+{
+    for (const Instance &instance : m_instances)
+    {
+        Rectangle frame = source;
+        frame.x += instance.frame * source.width;
+        DrawTexturePro(atlas, frame, Rectangle{instance.x, instance.y, size.x, size.y},
+                       Vector2{0.0f, 0.0f}, 0.0f, tint);
+    }
+}
@@ -0,0 +1,41 @@
+#include "gameplay/TileLayerCache.hpp"
+#include <cmath>
+
+TileLayerCache::~TileLayerCache()
+{
+    if (m_loaded)
+    {
+        for (auto &frame : m_frames)
+        {
+            UnloadRenderTexture(frame);
+        }
+    }
+}
+
+void TileLayerCache::Load()
+{
+    for (auto &frame : m_frames)
+    {
+        frame = LoadRenderTexture(SIZE * TILE_PIXELS, SIZE * TILE_PIXELS);
+        SetTextureFilter(frame.texture, TEXTURE_FILTER_POINT);
+    }
+    m_loaded = true;
+    m_dirty = true;
+}
+
+void TileLayerCache::Draw(Vector2 position, float scale, int frame) const
+{
+    if (!m_loaded)
+    {
+        return;
+    }
+
+    const Texture2D &texture = m_frames[frame].texture;
+    const float size = static_cast<float>(SIZE * TILE_PIXELS);
+
+    // Render textures are stored upside down, hence the negative source height
+    DrawTexturePro(texture,
+                   Rectangle{0.0f, 0.0f, size, -size},
+                   Rectangle{std::round(position.x), std::round(position.y), size * scale, size * scale},
+                   Vector2{0.0f, 0.0f}, 0.0f, WHITE);
+}
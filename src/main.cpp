@@ -1,8 +1,15 @@
 #include "raylib.h"
 #include "resource_dir.h"
 #include "GameApplication.hpp"
+#include "HeadlessRunner.hpp"
+
+int main(int argc, char** argv) {
+    // Replay driven screenshot/benchmark runs, see HeadlessRunner.hpp
+    HeadlessOptions headlessOptions;
+    if (HeadlessRunner::ParseArgs(argc, argv, headlessOptions)) {
+        return HeadlessRunner(headlessOptions).Run();
+    }
 
-int main() {
     GameApplication app;
     app.Initialize();
     app.Run();
@@ -1,100 +1,73 @@
 #include "screens/GameplayScreen.hpp"
-#include "gameplay/PrairieKing.hpp"
+#include "gameplay/SimulationThread.hpp"
 
-GameplayScreen::GameplayScreen(AssetManager& assets, const Vector2& pixelScale)
-    : Screen(assets, pixelScale)
+GameplayScreen::GameplayScreen(AssetManager& assets)
+    : Screen(assets)
 {
-    m_game = std::make_unique<PrairieKing>(assets);
+    m_sim = std::make_unique<SimulationThread>(assets);
 }
 
+GameplayScreen::~GameplayScreen() = default;
+
 void GameplayScreen::Update(float deltaTime) {
+    // Input is read here on the main thread and handed to the simulation as one frame
+    PrairieKing::InputFrame input;
 
     // Handle debug keys first
-    if (IsKeyPressed(KEY_F3)) m_game->SetButtonState(PrairieKing::GameKeys::DebugToggle, true);
-    if (IsKeyPressed(KEY_F4)) m_game->SetButtonState(PrairieKing::GameKeys::DebugGodMode, true);
-    if (IsKeyPressed(KEY_F5)) m_game->SetButtonState(PrairieKing::GameKeys::DebugAddLife, true);
-    if (IsKeyPressed(KEY_F6)) m_game->SetButtonState(PrairieKing::GameKeys::DebugAddCoins, true);
-    if (IsKeyPressed(KEY_F7)) m_game->SetButtonState(PrairieKing::GameKeys::DebugIncDamage, true);
-    if (IsKeyPressed(KEY_F8)) m_game->SetButtonState(PrairieKing::GameKeys::DebugClearMonsters, true);
-    if (IsKeyPressed(KEY_F9)) m_game->SetButtonState(PrairieKing::GameKeys::DebugClearWave, true);
+    if (IsKeyPressed(KEY_F3)) input.keys.push_back({PrairieKing::GameKeys::DebugToggle, true});
+    if (IsKeyPressed(KEY_F4)) input.keys.push_back({PrairieKing::GameKeys::DebugGodMode, true});
+    if (IsKeyPressed(KEY_F5)) input.keys.push_back({PrairieKing::GameKeys::DebugAddLife, true});
+    if (IsKeyPressed(KEY_F6)) input.keys.push_back({PrairieKing::GameKeys::DebugAddCoins, true});
+    if (IsKeyPressed(KEY_F7)) input.keys.push_back({PrairieKing::GameKeys::DebugIncDamage, true});
+    if (IsKeyPressed(KEY_F8)) input.keys.push_back({PrairieKing::GameKeys::DebugClearMonsters, true});
+    if (IsKeyPressed(KEY_F9)) input.keys.push_back({PrairieKing::GameKeys::DebugClearWave, true});
 
     // Handle numpad monster spawn keys
-    if (IsKeyPressed(KEY_KP_1)) m_game->SetButtonState(PrairieKing::GameKeys::DebugSpawn1, true);
-    if (IsKeyPressed(KEY_KP_2)) m_game->SetButtonState(PrairieKing::GameKeys::DebugSpawn2, true);
-    if (IsKeyPressed(KEY_KP_3)) m_game->SetButtonState(PrairieKing::GameKeys::DebugSpawn3, true);
-    if (IsKeyPressed(KEY_KP_4)) m_game->SetButtonState(PrairieKing::GameKeys::DebugSpawn4, true);
-    if (IsKeyPressed(KEY_KP_5)) m_game->SetButtonState(PrairieKing::GameKeys::DebugSpawn5, true);
-    if (IsKeyPressed(KEY_KP_6)) m_game->SetButtonState(PrairieKing::GameKeys::DebugSpawn6, true);
-    if (IsKeyPressed(KEY_KP_7)) m_game->SetButtonState(PrairieKing::GameKeys::DebugSpawn7, true);
-    if (IsKeyPressed(KEY_KP_8)) m_game->SetButtonState(PrairieKing::GameKeys::DebugSpawn8, true);
-    if (IsKeyPressed(KEY_KP_9)) m_game->SetButtonState(PrairieKing::GameKeys::DebugSpawn9, true);
+    if (IsKeyPressed(KEY_KP_1)) input.keys.push_back({PrairieKing::GameKeys::DebugSpawn1, true});
+    if (IsKeyPressed(KEY_KP_2)) input.keys.push_back({PrairieKing::GameKeys::DebugSpawn2, true});
+    if (IsKeyPressed(KEY_KP_3)) input.keys.push_back({PrairieKing::GameKeys::DebugSpawn3, true});
+    if (IsKeyPressed(KEY_KP_4)) input.keys.push_back({PrairieKing::GameKeys::DebugSpawn4, true});
+    if (IsKeyPressed(KEY_KP_5)) input.keys.push_back({PrairieKing::GameKeys::DebugSpawn5, true});
+    if (IsKeyPressed(KEY_KP_6)) input.keys.push_back({PrairieKing::GameKeys::DebugSpawn6, true});
+    if (IsKeyPressed(KEY_KP_7)) input.keys.push_back({PrairieKing::GameKeys::DebugSpawn7, true});
+    if (IsKeyPressed(KEY_KP_8)) input.keys.push_back({PrairieKing::GameKeys::DebugSpawn8, true});
+    if (IsKeyPressed(KEY_KP_9)) input.keys.push_back({PrairieKing::GameKeys::DebugSpawn9, true});
 
-    if (IsKeyPressed(KEY_P)) m_game->SetButtonState(PrairieKing::GameKeys::Pause, true);
+    if (IsKeyPressed(KEY_P)) input.keys.push_back({PrairieKing::GameKeys::Pause, true});
 
 
     // Update input states for game
-    if (IsKeyDown(KEY_W))
-        m_game->SetButtonState(PrairieKing::GameKeys::MoveUp, true);
-    else
-        m_game->SetButtonState(PrairieKing::GameKeys::MoveUp, false);
-
-    if (IsKeyDown(KEY_S))
-        m_game->SetButtonState(PrairieKing::GameKeys::MoveDown, true);
-    else
-        m_game->SetButtonState(PrairieKing::GameKeys::MoveDown, false);
-
-    if (IsKeyDown(KEY_A))
-        m_game->SetButtonState(PrairieKing::GameKeys::MoveLeft, true);
-    else
-        m_game->SetButtonState(PrairieKing::GameKeys::MoveLeft, false);
-
-    if (IsKeyDown(KEY_D))
-        m_game->SetButtonState(PrairieKing::GameKeys::MoveRight, true);
-    else
-        m_game->SetButtonState(PrairieKing::GameKeys::MoveRight, false);
-
-    if (IsKeyDown(KEY_UP))
-        m_game->SetButtonState(PrairieKing::GameKeys::ShootUp, true);
-    else
-        m_game->SetButtonState(PrairieKing::GameKeys::ShootUp, false);
-
-    if (IsKeyDown(KEY_DOWN))
-        m_game->SetButtonState(PrairieKing::GameKeys::ShootDown, true);
-    else
-        m_game->SetButtonState(PrairieKing::GameKeys::ShootDown, false);
-
-    if (IsKeyDown(KEY_LEFT))
-        m_game->SetButtonState(PrairieKing::GameKeys::ShootLeft, true);
-    else
-        m_game->SetButtonState(PrairieKing::GameKeys::ShootLeft, false);
-
-    if (IsKeyDown(KEY_RIGHT))
-        m_game->SetButtonState(PrairieKing::GameKeys::ShootRight, true);
-    else
-        m_game->SetButtonState(PrairieKing::GameKeys::ShootRight, false);
-
-    if (IsKeyDown(KEY_ENTER))
-        m_game->SetButtonState(PrairieKing::GameKeys::SelectOption, true);
-    else
-        m_game->SetButtonState(PrairieKing::GameKeys::SelectOption, false);
-
-    if (IsKeyDown(KEY_SPACE))
-        m_game->SetButtonState(PrairieKing::GameKeys::UsePowerup, true);
-    else
-        m_game->SetButtonState(PrairieKing::GameKeys::UsePowerup, false);
-
-    if (IsKeyDown(KEY_ESCAPE))
-        m_game->SetButtonState(PrairieKing::GameKeys::Exit, true);
-    else
-        m_game->SetButtonState(PrairieKing::GameKeys::Exit, false);
-
-    m_game->Update(deltaTime);
+    input.keys.push_back({PrairieKing::GameKeys::MoveUp, IsKeyDown(KEY_W)});
+    input.keys.push_back({PrairieKing::GameKeys::MoveDown, IsKeyDown(KEY_S)});
+    input.keys.push_back({PrairieKing::GameKeys::MoveLeft, IsKeyDown(KEY_A)});
+    input.keys.push_back({PrairieKing::GameKeys::MoveRight, IsKeyDown(KEY_D)});
+    input.keys.push_back({PrairieKing::GameKeys::ShootUp, IsKeyDown(KEY_UP)});
+    input.keys.push_back({PrairieKing::GameKeys::ShootDown, IsKeyDown(KEY_DOWN)});
+    input.keys.push_back({PrairieKing::GameKeys::ShootLeft, IsKeyDown(KEY_LEFT)});
+    input.keys.push_back({PrairieKing::GameKeys::ShootRight, IsKeyDown(KEY_RIGHT)});
+    input.keys.push_back({PrairieKing::GameKeys::SelectOption, IsKeyDown(KEY_ENTER)});
+    input.keys.push_back({PrairieKing::GameKeys::UsePowerup, IsKeyDown(KEY_SPACE)});
+    input.keys.push_back({PrairieKing::GameKeys::Exit, IsKeyDown(KEY_ESCAPE)});
+
+    input.pointer = GetMousePosition();
+    input.pointerPressed = IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
+    input.screenWidth = GetScreenWidth();
+    input.screenHeight = GetScreenHeight();
+    input.fps = GetFPS();
+
+    m_sim->Step(input, deltaTime);
+
+    // Game::Update stops the loop; the simulation thread is joined when this screen goes away
+    if (m_sim->GetStatus().closeRequested) {
+        m_quitRequested = true;
+    }
 }
 
 void GameplayScreen::Draw() {
-    m_game->Draw();
+    m_renderer.Render(m_sim->GetDrawList(), m_assets.GetTexture(TextureId::Cursors));
 }
 
 bool GameplayScreen::IsFinished() const {
-    return m_game->IsGameOver() || m_game->ShouldReturnToMenu();
+    const SimulationThread::Status& status = m_sim->GetStatus();
+    return status.gameOver || status.returnToMenu;
 }
@@ -1,7 +1,7 @@
 #include "screens/HowToPlayScreen.hpp"
 
-HowToPlayScreen::HowToPlayScreen(AssetManager& assets, const Vector2& pixelScale)
-    : Screen(assets, pixelScale), 
+HowToPlayScreen::HowToPlayScreen(AssetManager& assets)
+    : Screen(assets), 
     m_currentPage(0) {}
 
 void HowToPlayScreen::Update(float deltaTime) {
@@ -13,45 +13,47 @@ void HowToPlayScreen::Update(float deltaTime) {
 void HowToPlayScreen::Draw() {
     float centerX = GetScreenWidth() / 2.0f;
     float centerY = GetScreenHeight() / 2.0f;
+    // Sizes below are in virtual pixels
+    const float px = GetPixelScale();
 
-    DrawTextEx(m_assets.GetFont("title"), "How To Play",
-               Vector2{centerX - 100, 50}, 40, 2, WHITE);
+    DrawTextEx(m_assets.GetFont(FontId::Title), "How To Play",
+               Vector2{centerX - 33 * px, 17 * px}, 13 * px, px, WHITE);
 
     // Draw different instructions based on current page
     switch (m_currentPage) {
         case 0:
-            DrawTextEx(m_assets.GetFont("text"), "Use WASD to move",
-                      Vector2{centerX - 200, centerY - 50}, 30, 2, WHITE);
-            DrawTextEx(m_assets.GetFont("text"), "Press Arrow Keys to shoot",
-                      Vector2{centerX - 200, centerY}, 30, 2, WHITE);
+            DrawTextEx(m_assets.GetFont(FontId::Text), "Use WASD to move",
+                      Vector2{centerX - 67 * px, centerY - 17 * px}, 10 * px, px, WHITE);
+            DrawTextEx(m_assets.GetFont(FontId::Text), "Press Arrow Keys to shoot",
+                      Vector2{centerX - 67 * px, centerY}, 10 * px, px, WHITE);
             break;
         case 1:
-            DrawTextEx(m_assets.GetFont("text"), "Space to use power-ups",
-                      Vector2{centerX - 200, centerY - 50}, 30, 2, WHITE);
-            DrawTextEx(m_assets.GetFont("text"), "Kill enemies and get upgrades",
-                      Vector2{centerX - 200, centerY}, 30, 2, WHITE);
+            DrawTextEx(m_assets.GetFont(FontId::Text), "Space to use power-ups",
+                      Vector2{centerX - 67 * px, centerY - 17 * px}, 10 * px, px, WHITE);
+            DrawTextEx(m_assets.GetFont(FontId::Text), "Kill enemies and get upgrades",
+                      Vector2{centerX - 67 * px, centerY}, 10 * px, px, WHITE);
             break;
         case 2:
-            DrawTextEx(m_assets.GetFont("text"), "Reach the end of each level",
-                      Vector2{centerX - 200, centerY - 50}, 30, 2, WHITE);
-            DrawTextEx(m_assets.GetFont("text"), "to progress through the game",
-                      Vector2{centerX - 200, centerY}, 30, 2, WHITE);
+            DrawTextEx(m_assets.GetFont(FontId::Text), "Reach the end of each level",
+                      Vector2{centerX - 67 * px, centerY - 17 * px}, 10 * px, px, WHITE);
+            DrawTextEx(m_assets.GetFont(FontId::Text), "to progress through the game",
+                      Vector2{centerX - 67 * px, centerY}, 10 * px, px, WHITE);
             break;
     }
 
     // Draw page indicators
-    DrawTextEx(m_assets.GetFont("text"), 
+    DrawTextEx(m_assets.GetFont(FontId::Text), 
                TextFormat("Page %d/%d", m_currentPage + 1, MAX_PAGES),
-               Vector2{centerX - 50.0f, GetScreenHeight() - 100.0f}, 
-               20.0f, 2.0f, WHITE);
+               Vector2{centerX - 17 * px, GetScreenHeight() - 33 * px}, 
+               7 * px, px, WHITE);
                
     // Draw Back button
     const char* backText = "Back";
-    Vector2 textSize = MeasureTextEx(m_assets.GetFont("text"), backText, 30, 2);
-    float backY = GetScreenHeight() - 80.0f;
-    DrawTextEx(m_assets.GetFont("text"), backText,
+    Vector2 textSize = MeasureTextEx(m_assets.GetFont(FontId::Text), backText, 10 * px, px);
+    float backY = GetScreenHeight() - 27 * px;
+    DrawTextEx(m_assets.GetFont(FontId::Text), backText,
                Vector2{centerX - textSize.x/2, backY},
-               30, 2, WHITE);
+               10 * px, px, WHITE);
 
     // Añadir interacción con el botón Back
     Vector2 mousePos = GetMousePosition();
@@ -63,16 +65,16 @@ void HowToPlayScreen::Draw() {
     };
 
     if (CheckCollisionPointRec(mousePos, backButton)) {
-        DrawTextEx(m_assets.GetFont("text"), backText,
+        DrawTextEx(m_assets.GetFont(FontId::Text), backText,
                    Vector2{centerX - textSize.x/2, backY},
-                   30, 2, RED);
+                   10 * px, px, RED);
         if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
             m_isFinished = true;
         }
     }
 
     // Draw navigation help
-    DrawTextEx(m_assets.GetFont("text"), "Use Left/Right arrows to navigate pages",
-               Vector2{centerX - 200.0f, GetScreenHeight() - 40.0f},
-               20, 2, GRAY);
+    DrawTextEx(m_assets.GetFont(FontId::Text), "Use Left/Right arrows to navigate pages",
+               Vector2{centerX - 67 * px, GetScreenHeight() - 13 * px},
+               7 * px, px, GRAY);
 }
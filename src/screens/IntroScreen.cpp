@@ -1,48 +1,29 @@
 #include "screens/IntroScreen.hpp"
 
-IntroScreen::IntroScreen(AssetManager& assets, const Vector2& pixelScale)
-    : Screen(assets, pixelScale), 
+IntroScreen::IntroScreen(AssetManager& assets)
+    : Screen(assets), 
     m_phase(IntroPhase::CompanyLogo),
     m_alpha(0),
     m_timer(0),
     m_showPressStart(true),
-    m_blinkTimer(0),
-    m_gameLogo({0, 0, 0, 0}),
-    m_gameLogoDest({0, 0, 0, 0}),
-    m_pressStart({0, 0, 0, 0}),
-    m_pressStartDest({0, 0, 0, 0}) {}
+    m_blinkTimer(0) {}
 
 void IntroScreen::Update(float deltaTime) {
-    if (m_phase == IntroPhase::WaitForInput) {
-        // Cache logo rectangles on first frame
-        if (m_gameLogo.width == 0) {
-            m_gameLogo = { 0, 96, 96, 56 };
-            float logoScale = 500.0f / 56.0f;
-            m_gameLogoDest = {
-                GetScreenWidth()/2.0f - (96 * logoScale)/2,
-                GetScreenHeight()/2.0f - (56 * logoScale)/2,
-                96 * logoScale,
-                56 * logoScale
-            };
-            
-            m_pressStart = { 24, 155, 49, 7 };
-            float pressStartScale = 250.0f / 49.0f;
-            m_pressStartDest = {
-                GetScreenWidth()/2.0f - (49 * pressStartScale)/2,
-                GetScreenHeight()/2.0f + (56 * logoScale)/2 + 20,
-                49 * pressStartScale,
-                7 * pressStartScale
-            };
-        }
+    // Assets are still loading in the background; the fades start once there is something to show
+    if (!m_assets.AreGraphicsLoaded()) {
+        return;
+    }
 
+    if (m_phase == IntroPhase::WaitForInput) {
         m_blinkTimer += deltaTime;
         if (m_blinkTimer >= BLINK_INTERVAL) {
             m_blinkTimer = 0;
             m_showPressStart = !m_showPressStart;
         }
         
-        if (IsKeyPressed(KEY_SPACE)) {
-            PlaySound(m_assets.GetSound("pickup_coin")); // Reproducir sonido antes de la animación
+        // The menu and the game need everything, so wait here until loading is done
+        if (m_assets.IsLoaded() && IsKeyPressed(KEY_SPACE)) {
+            PlaySound(m_assets.GetSound(SoundId::PickupCoin)); // Reproducir sonido antes de la animación
             DoBlinkAnimation();
             m_phase = IntroPhase::Done;
             m_isFinished = true;
@@ -94,34 +75,16 @@ void IntroScreen::UpdateFade(float deltaTime) {
 }
 
 void IntroScreen::Draw() {
-    if (m_phase == IntroPhase::WaitForInput) {
-        float centerX = GetScreenWidth() / 2.0f;
-        float centerY = GetScreenHeight() / 2.0f;
-        float screenHeight = GetScreenHeight();
+    if (!m_assets.AreGraphicsLoaded()) {
+        return;
+    }
 
-        // Game logo un poco más pequeño
-        Rectangle logoSource = { 0, 96, 96, 56 };
-        float logoScale = 400.0f / 56.0f;  // Reducido de 500 a 400
-        Rectangle logoDest = {
-            centerX - (96 * logoScale)/2,
-            centerY - (56 * logoScale)/2 - 50,
-            96 * logoScale,
-            56 * logoScale
-        };
-        
-        DrawTexturePro(m_assets.GetTexture("cursors"), logoSource, logoDest,
+    if (m_phase == IntroPhase::WaitForInput) {
+        DrawTexturePro(m_assets.GetTexture(TextureId::Cursors), TITLE_LOGO_SOURCE, GetTitleLogoDest(),
                       Vector2{0, 0}, 0.0f, WHITE);
 
-        if (m_showPressStart) {
-            Rectangle pressStartSource = { 24, 155, 49, 7 };
-            float pressStartScale = 300.0f / 49.0f;  // Aumentado de 250 a 300
-            Rectangle pressStartDest = {
-                centerX - (49 * pressStartScale)/2,
-                centerY + (56 * logoScale)/2 + 30,  // Ajustado el espaciado
-                49 * pressStartScale,
-                7 * pressStartScale
-            };
-            DrawTexturePro(m_assets.GetTexture("cursors"), pressStartSource, pressStartDest,
+        if (m_showPressStart && m_assets.IsLoaded()) {
+            DrawTexturePro(m_assets.GetTexture(TextureId::Cursors), PRESS_START_SOURCE, GetPressStartDest(),
                           Vector2{0, 0}, 0.0f, WHITE);
         }
 
@@ -130,6 +93,10 @@ void IntroScreen::Draw() {
 
     float centerX = GetScreenWidth() / 2.0f;
     float centerY = GetScreenHeight() / 2.0f;
+    // Sizes below are in virtual pixels
+    const float px = GetPixelScale();
+    const float textSize = 13 * px;
+    const float spacing = px;
 
     switch (m_phase) {
         case IntroPhase::CompanyLogo: {
@@ -142,26 +109,26 @@ void IntroScreen::Draw() {
             
             // Logo primero
             Rectangle logoSource = { 304, 160, 16, 16 };
-            float logoScale = 512.0f / 16.0f;
+            float logoScale = 10 * px;
             Rectangle logoDest = {
                 centerX - (16 * logoScale)/2,
-                centerY - (16 * logoScale)/2 - 40,  // Subimos el logo un poco
+                centerY - (16 * logoScale)/2 - 13 * px,  // Subimos el logo un poco
                 16 * logoScale,
                 16 * logoScale
             };
             
-            DrawTexturePro(m_assets.GetTexture("cursors"), logoSource, logoDest,
+            DrawTexturePro(m_assets.GetTexture(TextureId::Cursors), logoSource, logoDest,
                           Vector2{0, 0}, 0.0f, ColorAlpha(WHITE, logoFade));
 
             // Título de la compañía - con fade-in normal
             const char* companyName = "Amphoreous";
-            float fontSize = 80.0f;
+            float fontSize = 27 * px;
             
-            Font titleFont = m_assets.GetFont("title");
-            Vector2 textSize = MeasureTextEx(titleFont, companyName, fontSize, 2);
+            Font titleFont = m_assets.GetFont(FontId::Title);
+            Vector2 nameSize = MeasureTextEx(titleFont, companyName, fontSize, spacing);
             
             // Calculamos la posición vertical relativa al logo
-            float textY = logoDest.y + logoDest.height + 40;  // 40 píxeles debajo del logo
+            float textY = logoDest.y + logoDest.height + 13 * px;
             
             // Dibujamos el texto con sombra para mejor legibilidad
             Color shadowColor = ColorAlpha(BLACK, m_alpha * 0.5f);
@@ -169,15 +136,15 @@ void IntroScreen::Draw() {
             
             // Sombra
             DrawTextEx(titleFont, companyName,
-                      Vector2{centerX - textSize.x/2 + 2,
-                             textY + 2},
-                      fontSize, 2, shadowColor);
+                      Vector2{centerX - nameSize.x/2 + px,
+                             textY + px},
+                      fontSize, spacing, shadowColor);
             
             // Texto principal
             DrawTextEx(titleFont, companyName,
-                      Vector2{centerX - textSize.x/2,
+                      Vector2{centerX - nameSize.x/2,
                              textY},
-                      fontSize, 2, textColor);
+                      fontSize, spacing, textColor);
             break;
         }
         
@@ -188,105 +155,105 @@ void IntroScreen::Draw() {
                 "Sofia Giner Vargas\n"
                 "Joel Martinez Arjona";
                 
-            Vector2 textSize = MeasureTextEx(m_assets.GetFont("text"), text, 40, 2);
-            DrawTextEx(m_assets.GetFont("text"), text,
-                      Vector2{centerX - textSize.x/2,
-                             centerY - textSize.y/2},
-                      40, 2, ColorAlpha(WHITE, m_alpha));
+            Vector2 size = MeasureTextEx(m_assets.GetFont(FontId::Text), text, textSize, spacing);
+            DrawTextEx(m_assets.GetFont(FontId::Text), text,
+                      Vector2{centerX - size.x/2,
+                             centerY - size.y/2},
+                      textSize, spacing, ColorAlpha(WHITE, m_alpha));
             break;
         }
         
         case IntroPhase::ProjectInfo: {
-            Font titleFont = m_assets.GetFont("title");
-            Font textFont = m_assets.GetFont("text");
+            Font titleFont = m_assets.GetFont(FontId::Title);
+            Font textFont = m_assets.GetFont(FontId::Text);
             
             const char* titleText = "Project I";
-            Vector2 titleSize = MeasureTextEx(titleFont, titleText, 40, 2);
+            Vector2 titleSize = MeasureTextEx(titleFont, titleText, textSize, spacing);
             
             Color textColor = ColorAlpha(WHITE, m_alpha);
             
             // Texto principal
             DrawTextEx(titleFont, titleText,
                       Vector2{centerX - titleSize.x/2,
-                             centerY - 100},
-                      40, 2, textColor);
+                             centerY - 33 * px},
+                      textSize, spacing, textColor);
             
             // Sombra izquierda
             DrawTextEx(titleFont, titleText,
                       Vector2{centerX - titleSize.x/2 - 1,
-                             centerY - 100},
-                      40, 2, textColor);
+                             centerY - 33 * px},
+                      textSize, spacing, textColor);
             
             // Sombra derecha
             DrawTextEx(titleFont, titleText,
                       Vector2{centerX - titleSize.x/2 + 1,
-                             centerY - 100},
-                      40, 2, textColor);
+                             centerY - 33 * px},
+                      textSize, spacing, textColor);
             
             const char* subtextA = "Design and Development of Videogames";
             const char* subtextB = "CITM - UPC";
             const char* subtextC = "Tutor: Alejandro Paris Gomez";
             
-            Vector2 sizeA = MeasureTextEx(textFont, subtextA, 40, 2);
-            Vector2 sizeB = MeasureTextEx(textFont, subtextB, 40, 2);
-            Vector2 sizeC = MeasureTextEx(textFont, subtextC, 40, 2);
+            Vector2 sizeA = MeasureTextEx(textFont, subtextA, textSize, spacing);
+            Vector2 sizeB = MeasureTextEx(textFont, subtextB, textSize, spacing);
+            Vector2 sizeC = MeasureTextEx(textFont, subtextC, textSize, spacing);
             
             DrawTextEx(textFont, subtextA,
-                      Vector2{centerX - sizeA.x/2, centerY - 20},
-                      40, 2, ColorAlpha(WHITE, m_alpha));
+                      Vector2{centerX - sizeA.x/2, centerY - 7 * px},
+                      textSize, spacing, ColorAlpha(WHITE, m_alpha));
             DrawTextEx(textFont, subtextB,
-                      Vector2{centerX - sizeB.x/2, centerY + 20},
-                      40, 2, ColorAlpha(WHITE, m_alpha));
+                      Vector2{centerX - sizeB.x/2, centerY + 7 * px},
+                      textSize, spacing, ColorAlpha(WHITE, m_alpha));
             DrawTextEx(textFont, subtextC,
-                      Vector2{centerX - sizeC.x/2, centerY + 80},
-                      40, 2, ColorAlpha(WHITE, m_alpha));
+                      Vector2{centerX - sizeC.x/2, centerY + 27 * px},
+                      textSize, spacing, ColorAlpha(WHITE, m_alpha));
             break;
         }
         
         case IntroPhase::Description: {
-            Font titleFont = m_assets.GetFont("title");
-            Font textFont = m_assets.GetFont("text");
+            Font titleFont = m_assets.GetFont(FontId::Title);
+            Font textFont = m_assets.GetFont(FontId::Text);
             
             const char* titleText = "Journey of the Prairie King";
-            Vector2 titleSize = MeasureTextEx(titleFont, titleText, 40, 2);
+            Vector2 titleSize = MeasureTextEx(titleFont, titleText, textSize, spacing);
             
             Color textColor = ColorAlpha(WHITE, m_alpha);
             
             // Texto principal
             DrawTextEx(titleFont, titleText,
                       Vector2{centerX - titleSize.x/2,
-                             centerY - 100},
-                      40, 2, textColor);
+                             centerY - 33 * px},
+                      textSize, spacing, textColor);
             
             // Sombra izquierda
             DrawTextEx(titleFont, titleText,
                       Vector2{centerX - titleSize.x/2 - 1,
-                             centerY - 100},
-                      40, 2, textColor);
+                             centerY - 33 * px},
+                      textSize, spacing, textColor);
             
             // Sombra derecha
             DrawTextEx(titleFont, titleText,
                       Vector2{centerX - titleSize.x/2 + 1,
-                             centerY - 100},
-                      40, 2, textColor);
+                             centerY - 33 * px},
+                      textSize, spacing, textColor);
             
             const char* subtextA = "Play as the Prairie King, fight against several adversaries,";
             const char* subtextB = "upgrade your equipment, use some powerful power-ups to collect";
             const char* subtextC = "a few items that will help you get to your fiancee";
             
-            Vector2 sizeA = MeasureTextEx(textFont, subtextA, 40, 2);
-            Vector2 sizeB = MeasureTextEx(textFont, subtextB, 40, 2);
-            Vector2 sizeC = MeasureTextEx(textFont, subtextC, 40, 2);
+            Vector2 sizeA = MeasureTextEx(textFont, subtextA, textSize, spacing);
+            Vector2 sizeB = MeasureTextEx(textFont, subtextB, textSize, spacing);
+            Vector2 sizeC = MeasureTextEx(textFont, subtextC, textSize, spacing);
             
             DrawTextEx(textFont, subtextA,
-                      Vector2{centerX - sizeA.x/2, centerY - 20},
-                      40, 2, ColorAlpha(WHITE, m_alpha));
+                      Vector2{centerX - sizeA.x/2, centerY - 7 * px},
+                      textSize, spacing, ColorAlpha(WHITE, m_alpha));
             DrawTextEx(textFont, subtextB,
-                      Vector2{centerX - sizeB.x/2, centerY + 20},
-                      40, 2, ColorAlpha(WHITE, m_alpha));
+                      Vector2{centerX - sizeB.x/2, centerY + 7 * px},
+                      textSize, spacing, ColorAlpha(WHITE, m_alpha));
             DrawTextEx(textFont, subtextC,
-                      Vector2{centerX - sizeC.x/2, centerY + 60},
-                      40, 2, ColorAlpha(WHITE, m_alpha));
+                      Vector2{centerX - sizeC.x/2, centerY + 20 * px},
+                      textSize, spacing, ColorAlpha(WHITE, m_alpha));
             break;
         }
         
@@ -296,38 +263,21 @@ void IntroScreen::Draw() {
 }
 
 void IntroScreen::DoBlinkAnimation() {
-    // Actualizar las mismas dimensiones aquí también
-    float centerX = GetScreenWidth() / 2.0f;
-    float centerY = GetScreenHeight() / 2.0f;
-    float screenHeight = GetScreenHeight();
-
-    Rectangle logoSource = { 0, 96, 96, 56 };
-    float logoScale = 400.0f / 56.0f;
-    Rectangle logoDest = {
-        centerX - (96 * logoScale)/2,
-        centerY - (56 * logoScale)/2 - 50,
-        96 * logoScale,
-        56 * logoScale
-    };
-
-    Rectangle pressStartSource = { 24, 155, 49, 7 };
-    float pressStartScale = 300.0f / 49.0f;
-    Rectangle pressStartDest = {
-        centerX - (49 * pressStartScale)/2,
-        centerY + (56 * logoScale)/2 + 30,
-        49 * pressStartScale,
-        7 * pressStartScale
-    };
+    // Same layout as Draw
+    const Rectangle logoSource = TITLE_LOGO_SOURCE;
+    const Rectangle logoDest = GetTitleLogoDest();
+    const Rectangle pressStartSource = PRESS_START_SOURCE;
+    const Rectangle pressStartDest = GetPressStartDest();
 
     // Quick blink animation
     for (int i = 0; i < 10; i++) {
         BeginDrawing();
         ClearBackground(BLACK);
-        DrawTexturePro(m_assets.GetTexture("cursors"), logoSource, logoDest,
+        DrawTexturePro(m_assets.GetTexture(TextureId::Cursors), logoSource, logoDest,
                       Vector2{0, 0}, 0.0f, WHITE);
 
         if (i % 2 == 0) {
-            DrawTexturePro(m_assets.GetTexture("cursors"), pressStartSource, pressStartDest,
+            DrawTexturePro(m_assets.GetTexture(TextureId::Cursors), pressStartSource, pressStartDest,
                           Vector2{0, 0}, 0.0f, WHITE);
         }
 
@@ -339,7 +289,7 @@ void IntroScreen::DoBlinkAnimation() {
     for (int i = 0; i < 15; i++) {
         BeginDrawing();
         ClearBackground(BLACK);
-        DrawTexturePro(m_assets.GetTexture("cursors"), logoSource, logoDest,
+        DrawTexturePro(m_assets.GetTexture(TextureId::Cursors), logoSource, logoDest,
                       Vector2{0, 0}, 0.0f, WHITE);
 
         EndDrawing();
@@ -1,7 +1,7 @@
 #include "screens/SettingsScreen.hpp"
 
-SettingsScreen::SettingsScreen(AssetManager& assets, const Vector2& pixelScale)
-    : Screen(assets, pixelScale),
+SettingsScreen::SettingsScreen(AssetManager& assets)
+    : Screen(assets),
     m_displayMode(GetDisplayMode()),
     m_selectedOption(0),
     m_volume(GetMasterVolume() * 100),
@@ -15,8 +15,8 @@ void SettingsScreen::Update(float deltaTime) {
         m_showPrompt = !m_showPrompt;
     }
 
-    if (IsKeyPressed(KEY_UP)) m_selectedOption = (m_selectedOption - 1 + 3) % 3;
-    if (IsKeyPressed(KEY_DOWN)) m_selectedOption = (m_selectedOption + 1) % 3;
+    if (IsKeyPressed(KEY_UP)) m_selectedOption = (m_selectedOption - 1 + OPTION_COUNT) % OPTION_COUNT;
+    if (IsKeyPressed(KEY_DOWN)) m_selectedOption = (m_selectedOption + 1) % OPTION_COUNT;
 
     if (IsKeyPressed(KEY_ENTER)) {
         switch (m_selectedOption) {
@@ -25,7 +25,10 @@ void SettingsScreen::Update(float deltaTime) {
             case 1: // Display Mode
                 CycleDisplayMode();
                 break;
-            case 2: // Back
+            case 2: // Frame Rate
+                CycleFrameTarget(1);
+                break;
+            case 3: // Back
                 m_isFinished = true;
                 break;
         }
@@ -37,15 +40,22 @@ void SettingsScreen::Update(float deltaTime) {
         SetMasterVolume(m_volume / 100.0f);
     }
 
+    if (m_selectedOption == 2) {
+        if (IsKeyPressed(KEY_LEFT)) CycleFrameTarget(-1);
+        if (IsKeyPressed(KEY_RIGHT)) CycleFrameTarget(1);
+    }
+
     if (IsKeyPressed(KEY_ESCAPE)) m_isFinished = true;
 }
 
 void SettingsScreen::Draw() {
     float centerX = GetScreenWidth() / 2.0f;
     float centerY = GetScreenHeight() / 2.0f;
+    // Sizes below are in virtual pixels
+    const float px = GetPixelScale();
 
-    DrawTextEx(m_assets.GetFont("title"), "Settings",
-               Vector2{centerX - 100, centerY - 150}, 40, 2, WHITE);
+    m_titleText.Set(m_assets.GetFont(FontId::Title), "Settings", 13 * px, px);
+    m_titleText.Draw(Vector2{centerX - 33 * px, centerY - 50 * px}, WHITE);
 
     const char* displayModeText;
     switch (m_displayMode) {
@@ -63,13 +73,14 @@ void SettingsScreen::Draw() {
     const char* options[] = {
         TextFormat("Volume: %d%%", m_volume),
         TextFormat("Display Mode: %s", displayModeText),
+        TextFormat("Frame Rate: %s", FramePacer::GetTargetName(FramePacer::GetTarget())),
         "Back"
     };
 
-    for (int i = 0; i < 3; i++) {
+    for (int i = 0; i < OPTION_COUNT; i++) {
         Color color = (i == m_selectedOption) ? RED : WHITE;
-        DrawTextEx(m_assets.GetFont("text"), options[i],
-                  Vector2{centerX - 100, centerY - 50 + i * 40}, 30, 2, color);
+        m_optionText[i].Set(m_assets.GetFont(FontId::Text), options[i], 10 * px, px);
+        m_optionText[i].Draw(Vector2{centerX - 33 * px, centerY + (i * 13 - 17) * px}, color);
     }
 }
 
@@ -134,3 +145,9 @@ void SettingsScreen::CycleDisplayMode() {
             break;
     }
 }
+
+void SettingsScreen::CycleFrameTarget(int direction) {
+    const int count = static_cast<int>(FrameTarget::COUNT);
+    const int target = (static_cast<int>(FramePacer::GetTarget()) + direction + count) % count;
+    FramePacer::SetTarget(static_cast<FrameTarget>(target));
+}
@@ -0,0 +1,142 @@
+// Packs every file under resources/ into one archive the game memory maps at startup, so
+// loading is a single open instead of one per texture, sound and font.
+//
+// Usage: AssetArchiver <resources dir> <archive out>
+//
+// Run after AtlasPacker, since the atlas it writes is one of the packed files. The
+// archive is only rewritten when a resource is newer than it or the file list changed,
+// so running this before every build is cheap. See include/AssetArchive.hpp for the
+// layout.
+
+#include "AssetArchive.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+    struct Source {
+        std::string path;     // Archive path, relative to the resources dir
+        fs::path file;
+        uint64_t size;
+    };
+
+    uint64_t Align(uint64_t value) {
+        return (value + ArchiveFormat::ALIGNMENT - 1) / ArchiveFormat::ALIGNMENT * ArchiveFormat::ALIGNMENT;
+    }
+
+    // Same paths, and nothing modified since the archive was written
+    bool IsUpToDate(const fs::path& archivePath, const std::vector<Source>& sources) {
+        std::error_code error;
+        const fs::file_time_type written = fs::last_write_time(archivePath, error);
+        if (error) {
+            return false;
+        }
+
+        std::ifstream archive(archivePath, std::ios::binary);
+        ArchiveFormat::Header header = {};
+        if (!archive.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            std::memcmp(header.magic, ArchiveFormat::MAGIC, sizeof(header.magic)) != 0 ||
+            header.version != ArchiveFormat::VERSION || header.count != sources.size()) {
+            return false;
+        }
+
+        for (const Source& source : sources) {
+            ArchiveFormat::Entry entry = {};
+            if (!archive.read(reinterpret_cast<char*>(&entry), sizeof(entry)) ||
+                source.path != entry.path || source.size != entry.size ||
+                fs::last_write_time(source.file) > written) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::printf("Usage: %s <resources dir> <archive out>\n", argv[0]);
+        return 1;
+    }
+    const fs::path resources = argv[1];
+    const fs::path archivePath = argv[2];
+
+    std::error_code error;
+    const fs::path archiveFull = fs::weakly_canonical(archivePath, error);
+
+    std::vector<Source> sources;
+    for (const fs::directory_entry& item : fs::recursive_directory_iterator(resources)) {
+        if (!item.is_regular_file() || fs::weakly_canonical(item.path(), error) == archiveFull) {
+            continue;
+        }
+        std::string path = fs::relative(item.path(), resources).generic_string();
+        if (path.size() >= ArchiveFormat::MAX_PATH_LENGTH) {
+            std::printf("AssetArchiver: path too long: %s\n", path.c_str());
+            return 1;
+        }
+        sources.push_back(Source{ path, item.path(), static_cast<uint64_t>(item.file_size()) });
+    }
+
+    // The runtime binary searches the index, and a fixed order keeps the output stable
+    std::sort(sources.begin(), sources.end(), [](const Source& a, const Source& b) {
+        return std::strcmp(a.path.c_str(), b.path.c_str()) < 0;
+    });
+
+    if (IsUpToDate(archivePath, sources)) {
+        std::printf("AssetArchiver: %s is up to date\n", archivePath.generic_string().c_str());
+        return 0;
+    }
+
+    ArchiveFormat::Header header = {};
+    std::memcpy(header.magic, ArchiveFormat::MAGIC, sizeof(header.magic));
+    header.version = ArchiveFormat::VERSION;
+    header.count = static_cast<uint32_t>(sources.size());
+
+    std::vector<ArchiveFormat::Entry> entries(sources.size());
+    uint64_t offset = Align(sizeof(header) + entries.size() * sizeof(ArchiveFormat::Entry));
+    for (size_t i = 0; i < sources.size(); i++) {
+        entries[i] = {};
+        entries[i].offset = offset;
+        entries[i].size = sources[i].size;
+        std::memcpy(entries[i].path, sources[i].path.c_str(), sources[i].path.size() + 1);
+        offset = Align(offset + sources[i].size);
+    }
+
+    std::ofstream archive(archivePath, std::ios::binary | std::ios::trunc);
+    if (!archive.is_open()) {
+        std::printf("AssetArchiver: can't write %s\n", archivePath.generic_string().c_str());
+        return 1;
+    }
+    archive.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    archive.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(ArchiveFormat::Entry));
+
+    const char padding[ArchiveFormat::ALIGNMENT] = {};
+    for (size_t i = 0; i < sources.size(); i++) {
+        const uint64_t written = static_cast<uint64_t>(archive.tellp());
+        archive.write(padding, static_cast<std::streamsize>(entries[i].offset - written));
+
+        // Inserting an empty stream buffer would set failbit on the archive
+        std::ifstream file(sources[i].file, std::ios::binary);
+        if (file.is_open() && entries[i].size > 0) {
+            archive << file.rdbuf();
+        }
+        if (!file.is_open() || static_cast<uint64_t>(archive.tellp()) != entries[i].offset + entries[i].size) {
+            std::printf("AssetArchiver: can't read %s\n", sources[i].file.generic_string().c_str());
+            return 1;
+        }
+    }
+
+    if (!archive.flush()) {
+        std::printf("AssetArchiver: can't write %s\n", archivePath.generic_string().c_str());
+        return 1;
+    }
+
+    std::printf("AssetArchiver: %zu files, %llu bytes\n", sources.size(),
+                static_cast<unsigned long long>(archive.tellp()));
+    return 0;
+}
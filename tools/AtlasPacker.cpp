@@ -0,0 +1,241 @@
+// Packs every texture the game samples into one atlas so a whole frame (sprites, HUD
+// text, debug text and shapes) can be drawn without switching textures.
+//
+// Usage: AtlasPacker <resources dir> <header out>
+//
+// Writes <resources dir>/atlas/atlas.png and a header with the region of each source
+// image inside it. The cursors sheet is always placed at the origin, so the sprite rects
+// hardcoded around the gameplay code keep working unchanged. The atlas and the header are
+// only rewritten when their contents change, so running this before every build is
+// cheap and doesn't make later steps (AssetArchiver) redo their work.
+//
+// No window or GL context is needed. raylib's default font only exists once a window
+// does, so its region is left blank here and AssetManager draws the font into it when
+// the atlas is loaded.
+
+#include "raylib.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Region {
+        const char* name;   // Constant emitted in the header
+        const char* path;   // Relative to the resources dir, nullptr for generated images
+        Image image;
+        int x;
+        int y;
+    };
+
+    // Transparent gap between regions so filtering never bleeds a neighbour in
+    constexpr int PADDING = 2;
+    constexpr int MIN_SIZE = 256;
+    constexpr int MAX_SIZE = 4096;
+
+    // 3x3 white block; shapes sample its center texel
+    constexpr int WHITE_SIZE = 3;
+
+    // raylib always builds its default font sheet at this size
+    constexpr int DEFAULT_FONT_SIZE = 128;
+
+    // Rows left to right, wrapping at width. The first region is pinned at the origin.
+    // Returns the atlas height needed, or -1 if something doesn't fit in the width
+    int PackRows(std::vector<Region>& regions, int width) {
+        int x = 0;
+        int y = 0;
+        int rowHeight = 0;
+        for (Region& region : regions) {
+            if (region.image.width > width) {
+                return -1;
+            }
+            if (x + region.image.width > width) {
+                x = 0;
+                y += rowHeight + PADDING;
+                rowHeight = 0;
+            }
+            region.x = x;
+            region.y = y;
+            x += region.image.width + PADDING;
+            rowHeight = std::max(rowHeight, region.image.height);
+        }
+        return y + rowHeight;
+    }
+
+    int NextPowerOfTwo(int value) {
+        int result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    std::string MakeHeader(const std::vector<Region>& regions, int width, int height) {
+        std::ostringstream out;
+        out << "// Generated by AtlasPacker from the files under resources/, do not edit\n";
+        out << "#pragma once\n";
+        out << "#include \"raylib.h\"\n\n";
+        out << "namespace AtlasLayout {\n";
+        out << "    constexpr const char* IMAGE_PATH = \"atlas/atlas.png\";\n";
+        out << "    constexpr int WIDTH = " << width << ";\n";
+        out << "    constexpr int HEIGHT = " << height << ";\n\n";
+        for (const Region& region : regions) {
+            int x = region.x;
+            int y = region.y;
+            int w = region.image.width;
+            int h = region.image.height;
+            if (region.path == nullptr && std::string(region.name) == "WHITE_TEXEL") {
+                x += 1;
+                y += 1;
+                w = 1;
+                h = 1;
+            }
+            out << "    constexpr Rectangle " << region.name << " = { "
+                << x << ", " << y << ", " << w << ", " << h << " };\n";
+        }
+        out << "}\n";
+        return out.str();
+    }
+
+    // Compares pixels rather than file bytes, since PNG encoding isn't part of the contract
+    bool ExportIfChanged(const Image& image, const std::string& path) {
+        if (FileExists(path.c_str())) {
+            Image existing = LoadImage(path.c_str());
+            ImageFormat(&existing, image.format);
+            const bool same = existing.data != nullptr && existing.width == image.width &&
+                              existing.height == image.height &&
+                              std::memcmp(existing.data, image.data,
+                                          GetPixelDataSize(image.width, image.height, image.format)) == 0;
+            UnloadImage(existing);
+            if (same) {
+                return true;
+            }
+        }
+        return ExportImage(image, path.c_str());
+    }
+
+    bool WriteIfChanged(const std::string& path, const std::string& contents) {
+        std::ifstream existing(path, std::ios::binary);
+        if (existing.is_open()) {
+            std::ostringstream current;
+            current << existing.rdbuf();
+            if (current.str() == contents) {
+                return true;
+            }
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file << contents;
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::printf("Usage: %s <resources dir> <header out>\n", argv[0]);
+        return 1;
+    }
+    const std::string resources = argv[1];
+    const std::string headerPath = argv[2];
+
+    std::vector<Region> regions = {
+        { "CURSORS", "cursors/cursors_1.png", {}, 0, 0 },
+        { "TITLE_FONT", "fonts/SpriteFont1/SpriteFont1.png", {}, 0, 0 },
+        { "TEXT_FONT", "fonts/SmallFont/SmallFont.png", {}, 0, 0 },
+        { "DEFAULT_FONT", nullptr, {}, 0, 0 },
+        { "WHITE_TEXEL", nullptr, {}, 0, 0 },
+    };
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    bool ok = true;
+    for (Region& region : regions) {
+        if (region.path != nullptr) {
+            std::string path = resources + "/" + region.path;
+            region.image = LoadImage(path.c_str());
+            if (region.image.data == nullptr) {
+                std::printf("AtlasPacker: can't load %s\n", path.c_str());
+                ok = false;
+            }
+        }
+        else if (std::string(region.name) == "DEFAULT_FONT") {
+            region.image = GenImageColor(DEFAULT_FONT_SIZE, DEFAULT_FONT_SIZE, BLANK);
+        }
+        else {
+            region.image = GenImageColor(WHITE_SIZE, WHITE_SIZE, WHITE);
+        }
+        ImageFormat(&region.image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+
+    if (!ok) {
+        return 1;
+    }
+
+    // Everything after the pinned cursors sheet goes tallest first, which keeps rows tight
+    std::stable_sort(regions.begin() + 1, regions.end(), [](const Region& a, const Region& b) {
+        return a.image.height > b.image.height;
+    });
+
+    // Smallest power of two square-ish atlas that holds everything
+    int bestWidth = 0;
+    int bestHeight = 0;
+    for (int width = MIN_SIZE; width <= MAX_SIZE; width *= 2) {
+        int used = PackRows(regions, width);
+        if (used < 0) {
+            continue;
+        }
+        int height = NextPowerOfTwo(std::max(used, MIN_SIZE));
+        if (height <= MAX_SIZE && (bestWidth == 0 || width * height < bestWidth * bestHeight)) {
+            bestWidth = width;
+            bestHeight = height;
+        }
+    }
+    if (bestWidth == 0) {
+        std::printf("AtlasPacker: sources don't fit in %dx%d\n", MAX_SIZE, MAX_SIZE);
+        return 1;
+    }
+    PackRows(regions, bestWidth);
+
+    Image atlas = GenImageColor(bestWidth, bestHeight, BLANK);
+    for (Region& region : regions) {
+        Rectangle source = { 0, 0, (float)region.image.width, (float)region.image.height };
+        Rectangle dest = { (float)region.x, (float)region.y, source.width, source.height };
+        ImageDraw(&atlas, region.image, source, dest, WHITE);
+        UnloadImage(region.image);
+    }
+
+    std::string atlasDir = resources + "/atlas";
+    if (!DirectoryExists(atlasDir.c_str())) {
+        MakeDirectory(atlasDir.c_str());
+    }
+    std::string atlasPath = atlasDir + "/atlas.png";
+    bool exported = ExportIfChanged(atlas, atlasPath);
+    UnloadImage(atlas);
+    if (!exported) {
+        std::printf("AtlasPacker: can't write %s\n", atlasPath.c_str());
+        return 1;
+    }
+
+    const char* headerDir = GetDirectoryPath(headerPath.c_str());
+    if (!DirectoryExists(headerDir)) {
+        MakeDirectory(headerDir);
+    }
+
+    // Emit regions in a fixed order so the header doesn't change with the packing order
+    std::sort(regions.begin(), regions.end(), [](const Region& a, const Region& b) {
+        return std::string(a.name) < std::string(b.name);
+    });
+    if (!WriteIfChanged(headerPath, MakeHeader(regions, bestWidth, bestHeight))) {
+        std::printf("AtlasPacker: can't write %s\n", headerPath.c_str());
+        return 1;
+    }
+
+    std::printf("AtlasPacker: %dx%d atlas, %zu regions\n", bestWidth, bestHeight, regions.size());
+    return 0;
+}
@@ -0,0 +1,230 @@
+// Micro-benchmarks for the collision broadphases:
+// - map collision: the per-tile classification the game used to do on every query against
+//   the blocked-tile masks PrairieKing::IsRectBlocked tests now, on a fixed 16x16 map with
+//   every tile type on it
+// - bullets vs monsters: the old scan over every monster for every player bullet against
+//   the monster grid UpdateBullets queries now, from a hundred to thousands of bullets
+//
+// Usage: CollisionBench [queries per pass] [passes]
+//
+// Each pair runs the same rectangles and the answers are checked to agree before anything
+// is timed. Needs nothing but the headers, so it runs on CI machines without a display.
+
+#include "gameplay/PrairieKing.hpp"
+#include "gameplay/SpatialGrid.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+    constexpr int TILE = PrairieKing::BASE_TILE_SIZE * PrairieKing::PIXEL_ZOOM;
+    constexpr int MAP_SIZE = PrairieKing::MAP_WIDTH;
+
+    using Map = int[MAP_SIZE][MAP_SIZE];
+
+    // What IsCollidingWithMap did before the masks: divide, then classify every tile
+    bool IsRectBlockedPerTile(const Map& map, uint8_t layer, Rectangle r) {
+        int tileX1 = static_cast<int>(r.x) / TILE;
+        int tileY1 = static_cast<int>(r.y) / TILE;
+        int tileX2 = static_cast<int>(r.x + r.width - 1) / TILE;
+        int tileY2 = static_cast<int>(r.y + r.height - 1) / TILE;
+
+        for (int y = tileY1; y <= tileY2; y++) {
+            for (int x = tileX1; x <= tileX2; x++) {
+                if (x < 0 || x >= MAP_SIZE || y < 0 || y >= MAP_SIZE) {
+                    return true;
+                }
+                if (PrairieKing::GetTileCollisionLayers(map[x][y]) & layer) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Desert with a barrier border, a fence run, a trench pair and scattered cacti
+    void BuildMap(Map& map) {
+        for (int x = 0; x < MAP_SIZE; x++) {
+            for (int y = 0; y < MAP_SIZE; y++) {
+                const bool border = x == 0 || y == 0 || x == MAP_SIZE - 1 || y == MAP_SIZE - 1;
+                map[x][y] = border ? PrairieKing::MAP_BARRIER1 : PrairieKing::MAP_DESERT;
+            }
+        }
+        for (int x = 4; x < 12; x++) {
+            map[x][4] = PrairieKing::MAP_FENCE;
+        }
+        map[7][10] = PrairieKing::MAP_TRENCH1;
+        map[8][10] = PrairieKing::MAP_TRENCH2;
+        for (int i = 0; i < 12; i++) {
+            map[1 + std::rand() % (MAP_SIZE - 2)][1 + std::rand() % (MAP_SIZE - 2)] = PrairieKing::MAP_CACTUS;
+        }
+    }
+
+    TileMask BuildMask(const Map& map, uint8_t layer) {
+        TileMask blocked;
+        for (int x = 0; x < MAP_SIZE; x++) {
+            for (int y = 0; y < MAP_SIZE; y++) {
+                if (PrairieKing::GetTileCollisionLayers(map[x][y]) & layer) {
+                    blocked.Set(x, y);
+                }
+            }
+        }
+        return blocked;
+    }
+
+    struct Monster {
+        Rectangle position;
+        int index;    // In the monster list; the old scan went newest first
+        int gridCell;
+    };
+
+    // Not CheckCollisionRecs, so this doesn't need raylib's library
+    bool Overlaps(const Rectangle& a, const Rectangle& b) {
+        return a.x < b.x + b.width && a.x + a.width > b.x && a.y < b.y + b.height && a.y + a.height > b.y;
+    }
+
+    // One bullet step: the 12x12 box swept BULLET_SPEED pixels along its motion
+    Rectangle RandomBulletStep() {
+        const float x = static_cast<float>(std::rand() % (MAP_SIZE * TILE));
+        const float y = static_cast<float>(std::rand() % (MAP_SIZE * TILE));
+        return (std::rand() % 2 == 0) ? Rectangle{ x, y, 12.0f + PrairieKing::BULLET_SPEED, 12.0f }
+                                      : Rectangle{ x, y, 12.0f, 12.0f + PrairieKing::BULLET_SPEED };
+    }
+
+    // Both give the newest monster the bullet touches, -1 for none
+    int FirstHitLinear(const std::vector<Monster>& monsters, const Rectangle& bullet) {
+        for (int i = static_cast<int>(monsters.size()) - 1; i >= 0; i--) {
+            if (Overlaps(bullet, monsters[i].position)) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    int FirstHitGrid(const SpatialGrid<Monster>& grid, const Rectangle& bullet) {
+        int newest = -1;
+        grid.Query(bullet, [&](Monster* monster) {
+            if (monster->index > newest && Overlaps(bullet, monster->position)) {
+                newest = monster->index;
+            }
+            return false;
+        });
+        return newest;
+    }
+
+    template <typename Query>
+    double NanosecondsPerQuery(const std::vector<Rectangle>& rects, int passes, Query query, long long& hits) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < passes; pass++) {
+            for (const Rectangle& r : rects) {
+                hits += query(r) ? 1 : 0;
+            }
+        }
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / (static_cast<double>(rects.size()) * passes);
+    }
+}
+
+int main(int argc, char** argv) {
+    const int count = argc > 1 ? std::atoi(argv[1]) : 4096;
+    const int passes = argc > 2 ? std::atoi(argv[2]) : 2000;
+    if (count <= 0 || passes <= 0) {
+        std::printf("Usage: %s [queries per pass] [passes]\n", argv[0]);
+        return 1;
+    }
+
+    std::srand(1);
+    Map map;
+    BuildMap(map);
+
+    // Player and monster sized boxes, some hanging off the map edges
+    std::vector<Rectangle> rects(count);
+    for (Rectangle& r : rects) {
+        const float size = (std::rand() % 2 == 0) ? TILE / 2.0f : static_cast<float>(TILE);
+        r = { static_cast<float>(std::rand() % (MAP_SIZE * TILE + TILE) - TILE / 2),
+              static_cast<float>(std::rand() % (MAP_SIZE * TILE + TILE) - TILE / 2), size, size };
+    }
+
+    const struct {
+        const char* name;
+        uint8_t layer;
+    } layers[] = {
+        { "player", PrairieKing::LAYER_PLAYER },
+        { "walker", PrairieKing::LAYER_WALKER },
+        { "bullet", PrairieKing::LAYER_BULLET },
+    };
+
+    std::printf("CollisionBench: %d rects x %d passes\n", count, passes);
+    for (const auto& layer : layers) {
+        const TileMask blocked = BuildMask(map, layer.layer);
+        auto perTile = [&](const Rectangle& r) { return IsRectBlockedPerTile(map, layer.layer, r); };
+        auto masked = [&](const Rectangle& r) { return PrairieKing::IsRectBlocked(blocked, r); };
+
+        for (const Rectangle& r : rects) {
+            if (perTile(r) != masked(r)) {
+                std::printf("CollisionBench: %s answers differ at %.0f,%.0f %.0fx%.0f\n",
+                            layer.name, r.x, r.y, r.width, r.height);
+                return 1;
+            }
+        }
+
+        long long perTileHits = 0;
+        long long maskedHits = 0;
+        const double perTileNs = NanosecondsPerQuery(rects, passes, perTile, perTileHits);
+        const double maskedNs = NanosecondsPerQuery(rects, passes, masked, maskedHits);
+        std::printf("  %s  per tile %.2f ns  mask %.2f ns  (%.1fx, %lld hits)\n", layer.name,
+                    perTileNs, maskedNs, perTileNs / maskedNs, maskedHits / passes);
+        if (perTileHits != maskedHits) {
+            return 1;
+        }
+    }
+
+    // A wave is a few dozen monsters, the horde stress test thousands. Bullets are per tick:
+    // shotgun plus rapid fire keeps a few hundred in the air, the rest is headroom
+    const int monsterCounts[] = { 50, 2000 };
+    const int bulletCounts[] = { 100, 1000, 5000 };
+    const int bulletPasses = std::max(1, passes / 20);
+
+    std::printf("Bullets vs monsters: ms per tick for all bullets, %d passes\n", bulletPasses);
+    for (int monsterCount : monsterCounts) {
+        std::vector<Monster> monsters(monsterCount);
+        SpatialGrid<Monster> grid(MAP_SIZE, MAP_SIZE, static_cast<float>(TILE));
+        for (int i = 0; i < monsterCount; i++) {
+            monsters[i].position = { static_cast<float>(std::rand() % ((MAP_SIZE - 1) * TILE)),
+                                     static_cast<float>(std::rand() % ((MAP_SIZE - 1) * TILE)),
+                                     static_cast<float>(TILE), static_cast<float>(TILE) };
+            monsters[i].index = i;
+            grid.Insert(&monsters[i], monsters[i].position, monsters[i].gridCell);
+        }
+
+        for (int bulletCount : bulletCounts) {
+            std::vector<Rectangle> bullets(bulletCount);
+            for (Rectangle& bullet : bullets) {
+                bullet = RandomBulletStep();
+            }
+
+            auto linear = [&](const Rectangle& r) { return FirstHitLinear(monsters, r); };
+            auto gridded = [&](const Rectangle& r) { return FirstHitGrid(grid, r); };
+            for (const Rectangle& bullet : bullets) {
+                if (linear(bullet) != gridded(bullet)) {
+                    std::printf("CollisionBench: bullet hits differ at %.0f,%.0f\n", bullet.x, bullet.y);
+                    return 1;
+                }
+            }
+
+            long long linearHits = 0;
+            long long gridHits = 0;
+            auto hit = [](int index) { return index >= 0; };
+            const double linearNs = NanosecondsPerQuery(bullets, bulletPasses, [&](const Rectangle& r) { return hit(linear(r)); }, linearHits);
+            const double gridNs = NanosecondsPerQuery(bullets, bulletPasses, [&](const Rectangle& r) { return hit(gridded(r)); }, gridHits);
+            std::printf("  %4d monsters %5d bullets  scan %8.4f ms  grid %7.4f ms  (%.1fx)\n", monsterCount, bulletCount,
+                        linearNs * bulletCount / 1e6, gridNs * bulletCount / 1e6, linearNs / gridNs);
+            if (linearHits != gridHits) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,154 @@
+// Bakes the glyph metrics of the two sprite fonts into a header, so the game doesn't parse
+// their JSON descriptions (and doesn't carry json.hpp) at runtime.
+//
+// Usage: FontConverter <resources dir> <header out>
+//
+// Reads fonts/SpriteFont1/SpriteFont1.json and fonts/SmallFont/SmallFont.json and writes
+// the finished raylib GlyphInfo and Rectangle arrays, so AssetManager only copies them
+// and moves the rects to where AtlasPacker placed each sheet. The header is only
+// rewritten when its contents change, so running this before every build is cheap.
+
+#include "JsonHelper.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr int GLYPH_COUNT = 256;
+
+    struct Glyph {
+        int value;
+        int offsetX;
+        int offsetY;
+        int advanceX;
+        int x;
+        int y;
+        int width;
+        int height;
+    };
+
+    struct BakedFont {
+        const char* name; // Prefix of the constants emitted in the header
+        int baseSize;
+        std::vector<Glyph> glyphs;
+    };
+
+    std::vector<Glyph> DefaultGlyphs(int advanceX) {
+        std::vector<Glyph> glyphs(GLYPH_COUNT);
+        for (int i = 0; i < GLYPH_COUNT; i++) {
+            glyphs[i] = Glyph{ i, 0, 0, advanceX, 0, 0, 0, 0 };
+        }
+        return glyphs;
+    }
+
+    // Title font: glyphs sit at their character code
+    BakedFont BakeTitleFont(const FontData& data) {
+        BakedFont font{ "TITLE", data.verticalLineSpacing, DefaultGlyphs(data.verticalLineSpacing / 2) };
+        for (const auto& [c, glyphData] : data.characters) {
+            int i = (int)c;
+            if (i >= 0 && i < GLYPH_COUNT) {
+                // Extra spacing between characters on top of the sheet's own
+                font.glyphs[i] = Glyph{ i, glyphData.cropX, glyphData.cropY,
+                                        glyphData.cropWidth + data.horizontalSpacing + 4,
+                                        glyphData.texX, glyphData.texY, glyphData.texWidth, glyphData.texHeight };
+            }
+        }
+        return font;
+    }
+
+    // Text font: glyphs sit in character map order, each tagged with its character code
+    BakedFont BakeTextFont(const FontData& data) {
+        BakedFont font{ "TEXT", data.verticalLineSpacing, DefaultGlyphs(data.verticalLineSpacing / 2) };
+        for (size_t i = 0; i < data.characterMap.size() && i < GLYPH_COUNT; i++) {
+            char c = data.characterMap[i][0];
+            auto found = data.characters.find(c);
+            if (found == data.characters.end()) {
+                continue;
+            }
+            const GlyphData& glyphData = found->second;
+            font.glyphs[i] = Glyph{ (int)c, glyphData.cropX, glyphData.cropY,
+                                    glyphData.cropWidth + (data.horizontalSpacing / 2),
+                                    glyphData.texX, glyphData.texY, glyphData.texWidth, glyphData.texHeight };
+        }
+        return font;
+    }
+
+    std::string MakeHeader(const std::vector<BakedFont>& fonts) {
+        std::ostringstream out;
+        out << "// Generated by FontConverter from the files under resources/fonts, do not edit\n";
+        out << "#pragma once\n";
+        out << "#include \"raylib.h\"\n\n";
+        out << "// Glyph rects are relative to each font's own sheet, see AtlasLayout for where it sits\n";
+        out << "namespace FontMetrics {\n";
+        out << "    constexpr int GLYPH_COUNT = " << GLYPH_COUNT << ";\n";
+        for (const BakedFont& font : fonts) {
+            out << "\n    constexpr int " << font.name << "_BASE_SIZE = " << font.baseSize << ";\n\n";
+
+            out << "    constexpr GlyphInfo " << font.name << "_GLYPHS[GLYPH_COUNT] = {\n";
+            for (const Glyph& glyph : font.glyphs) {
+                out << "        { " << glyph.value << ", " << glyph.offsetX << ", " << glyph.offsetY << ", "
+                    << glyph.advanceX << ", {} },\n";
+            }
+            out << "    };\n\n";
+
+            out << "    constexpr Rectangle " << font.name << "_RECS[GLYPH_COUNT] = {\n";
+            for (const Glyph& glyph : font.glyphs) {
+                out << "        { " << glyph.x << ", " << glyph.y << ", " << glyph.width << ", " << glyph.height << " },\n";
+            }
+            out << "    };\n";
+        }
+        out << "}\n";
+        return out.str();
+    }
+
+    bool WriteIfChanged(const std::string& path, const std::string& contents) {
+        std::ifstream existing(path, std::ios::binary);
+        if (existing.is_open()) {
+            std::ostringstream current;
+            current << existing.rdbuf();
+            if (current.str() == contents) {
+                return true;
+            }
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file << contents;
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::printf("Usage: %s <resources dir> <header out>\n", argv[0]);
+        return 1;
+    }
+    const std::string resources = argv[1];
+    const std::string headerPath = argv[2];
+
+    const std::string titlePath = resources + "/fonts/SpriteFont1/SpriteFont1.json";
+    const std::string textPath = resources + "/fonts/SmallFont/SmallFont.json";
+    for (const std::string& path : { titlePath, textPath }) {
+        if (!std::ifstream(path).is_open()) {
+            std::printf("FontConverter: can't read %s\n", path.c_str());
+            return 1;
+        }
+    }
+
+    std::vector<BakedFont> fonts;
+    fonts.push_back(BakeTitleFont(JsonHelper::LoadFontData(titlePath)));
+    fonts.push_back(BakeTextFont(JsonHelper::LoadFontData(textPath)));
+
+    // AtlasPacker runs first and creates include/generated, this only needs to write into it
+    if (!WriteIfChanged(headerPath, MakeHeader(fonts))) {
+        std::printf("FontConverter: can't write %s\n", headerPath.c_str());
+        return 1;
+    }
+
+    std::printf("FontConverter: %zu fonts, %d glyphs each\n", fonts.size(), GLYPH_COUNT);
+    return 0;
+}
@@ -0,0 +1,85 @@
+#!/usr/bin/env bash
+# Plays every replay in tools/replays headless and compares its captures with the golden
+# PNGs in the folder of the same name (tools/replays/wave1.txt -> tools/replays/wave1/).
+# The ticks to capture come from the replay's "# capture 60,600" line.
+# It also runs the game's --check sweep, which compares bullet hits across step sizes.
+#
+# Usage: tools/replay_check.sh [--update] [game binary]
+#
+# --update writes the captures over the goldens instead of comparing; commit the result
+# after checking the images by eye. The binary defaults to bin/Release/<repo folder name>.
+# Without a display it runs under xvfb-run with Mesa's software renderer, so CPU-only
+# CI machines can run it. Exits non-zero if any replay crashes or differs from its goldens;
+# a replay with no goldens yet is only played, not compared.
+
+set -u
+
+root="$(cd "$(dirname "$0")/.." && pwd)"
+update=0
+if [ "${1:-}" = "--update" ]; then
+    update=1
+    shift
+fi
+game="${1:-$root/bin/Release/$(basename "$root")}"
+
+if [ ! -x "$game" ]; then
+    echo "replay_check: no game binary at $game" >&2
+    exit 2
+fi
+
+run=()
+if [ -z "${DISPLAY:-}" ]; then
+    if ! command -v xvfb-run > /dev/null; then
+        echo "replay_check: no display and no xvfb-run" >&2
+        exit 2
+    fi
+    export LIBGL_ALWAYS_SOFTWARE=1
+    run=(xvfb-run -a -s "-screen 0 1280x720x24")
+fi
+
+# The game looks for resources/ from the working directory
+cd "$root"
+
+failed=0
+
+# Not a replay, but it needs the same built game and display
+echo "replay_check: bullet sweep"
+if ! "${run[@]}" "$game" --headless --check sweep; then
+    failed=1
+fi
+
+for replay in "$root"/tools/replays/*.txt; do
+    name="$(basename "$replay" .txt)"
+    golden="$root/tools/replays/$name"
+    ticks="$(sed -n 's/^# capture \([0-9,]*\).*/\1/p' "$replay" | head -n 1)"
+    if [ -z "$ticks" ]; then
+        echo "replay_check: $name has no \"# capture\" line" >&2
+        failed=1
+        continue
+    fi
+
+    out="$root/headless_out/$name"
+    mkdir -p "$out"
+    args=(--headless --replay "$replay" --ticks "$ticks" --out "$out")
+    if [ "$update" -eq 0 ] && [ -d "$golden" ]; then
+        args+=(--golden "$golden")
+    fi
+
+    echo "replay_check: $name (ticks $ticks)"
+    if ! "${run[@]}" "$game" "${args[@]}"; then
+        failed=1
+        continue
+    fi
+
+    if [ "$update" -eq 1 ]; then
+        mkdir -p "$golden"
+        cp "$out"/tick_*.png "$golden"/
+        echo "replay_check: updated $golden"
+    elif [ ! -d "$golden" ]; then
+        # Still played through, so a crash shows up, and the captures are left in $out to
+        # be checked and committed as the goldens. Nothing to compare isn't a failure
+        echo "replay_check: $name has no goldens yet, not compared (see $out or run with --update)"
+    fi
+done
+
+exit "$failed"